@@ -1,5 +1,7 @@
 #include "Components/GWBScheduler.h"
 #include "GWBRuntimeModule.h"
+#include "CVars.h"
+#include "Utils/GWBClock.h"
 
 
 void UGWBScheduler::Start() 
@@ -25,20 +27,59 @@ void UGWBScheduler::TickWork()
 {
 	if (!TickDelegateHandle.IsValid()) return;
 	TickDelegateHandle.Invalidate();
+
+	// keep checking every frame until the interval has passed
+	if (!ConsumeWorkCycleInterval(FGWBClock::Seconds()))
+	{
+		ScheduleNextFrame();
+		return;
+	}
 	StartWorkCycleDelegate.ExecuteIfBound();
 };
+void UGWBScheduler::StartIdleTimer(float Delay)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		const auto Del = FTimerDelegate::CreateLambda([this]() { IdleDelegate.ExecuteIfBound(); });
+		World->GetTimerManager().SetTimer(IdleDelegateHandle, Del, FMath::Max(Delay, KINDA_SMALL_NUMBER), false);
+	}
+};
+bool UGWBScheduler::ConsumeWorkCycleInterval(double CurrentTimestamp)
+{
+	const double Interval = (double)CVarGWB_FrameInterval.GetValueOnGameThread();
+
+	// the first cycle never waits
+	const double ElapsedTime = LastTickTimestamp > 0.0 ? CurrentTimestamp - LastTickTimestamp : Interval;
+	LastTickTimestamp = CurrentTimestamp;
+
+	if (Interval <= 0.0)
+	{
+		AccumulatedTime = 0.0;
+		return true;
+	}
+
+	AccumulatedTime += ElapsedTime;
+	if (AccumulatedTime < Interval) return false;
+
+	// carry over the overshoot so the cadence stays accurate, but drop whole intervals that were missed (i.e. while idle)
+	// instead of trying to catch up on them with back to back cycles
+	AccumulatedTime = FMath::Fmod(AccumulatedTime, Interval);
+	return true;
+};
 void UGWBScheduler::Stop() 
 {
-	if (!TickDelegateHandle.IsValid()) return;
+	if (!TickDelegateHandle.IsValid() && !IdleDelegateHandle.IsValid()) return;
 	
 	UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBScheduler::Stop"));
 
 	if (const UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(TickDelegateHandle);
+		World->GetTimerManager().ClearTimer(IdleDelegateHandle);
 	}
 	else
 	{
 		TickDelegateHandle.Invalidate();
+		IdleDelegateHandle.Invalidate();
 	}
 };
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "DataTypes/GWBWorkUnitCallback.h"
+
+namespace
+{
+	/** Records per slab when the pool runs dry without a reservation. */
+	constexpr int32 MinSlabSize = 64;
+}
+
+FGWBWorkUnitCallbackPool& FGWBWorkUnitCallbackPool::Get()
+{
+	// intentionally leaked: handles held by objects destroyed during shutdown still release their records into it
+	static FGWBWorkUnitCallbackPool* Pool = new FGWBWorkUnitCallbackPool();
+	return *Pool;
+}
+
+void FGWBWorkUnitCallbackPool::Reserve(int32 NumRecords)
+{
+	if (NumRecords > Capacity)
+	{
+		AddSlab(NumRecords - Capacity);
+	}
+}
+
+FGWBWorkUnitCallbackPool::FRecord* FGWBWorkUnitCallbackPool::Allocate()
+{
+	checkSlow(IsInGameThread());
+	if (!FirstFree)
+	{
+		// grow geometrically so a pool that was never reserved settles after a few slabs
+		AddSlab(FMath::Max(Capacity, MinSlabSize));
+	}
+
+	FRecord* Record = FirstFree;
+	FirstFree = Record->NextFree;
+	Record->NextFree = nullptr;
+	NumRecordsInUse++;
+	return Record;
+}
+
+void FGWBWorkUnitCallbackPool::Release(FRecord* Record)
+{
+	checkSlow(IsInGameThread());
+	check(Record && Record->RefCount == 0);
+	Record->Callback.WorkCallback.Unbind();
+	Record->Callback.AbortCallback.Unbind();
+	Record->NextFree = FirstFree;
+	FirstFree = Record;
+	NumRecordsInUse--;
+}
+
+void FGWBWorkUnitCallbackPool::AddSlab(int32 NumRecords)
+{
+	TUniquePtr<FRecord[]>& Slab = Slabs.Add_GetRef(MakeUnique<FRecord[]>(NumRecords));
+
+	// thread the new records into the free list in address order
+	for (int32 i = NumRecords - 1; i >= 0; i--)
+	{
+		Slab[i].NextFree = FirstFree;
+		FirstFree = &Slab[i];
+	}
+	Capacity += NumRecords;
+}
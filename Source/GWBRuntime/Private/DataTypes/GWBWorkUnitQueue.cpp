@@ -0,0 +1,167 @@
+#include "DataTypes/GWBWorkUnitQueue.h"
+#include "Algo/BinarySearch.h"
+
+void FGWBWorkUnitQueue::Push(const FGWBQueuedWorkUnit& Entry, int32 Priority, bool bAddToFront)
+{
+	const int32 BucketIndex = FindOrAddBucket(Priority);
+	FBucket& Bucket = Buckets[BucketIndex];
+	if (bAddToFront)
+	{
+		Bucket.PushFront(Entry);
+	}
+	else
+	{
+		Bucket.PushBack(Entry);
+	}
+
+	if (NumEntries == 0 || BucketIndex < FrontBucketIndex)
+	{
+		FrontBucketIndex = BucketIndex;
+	}
+	LastPushedBucketIndex = BucketIndex;
+	NumEntries++;
+}
+
+const FGWBQueuedWorkUnit& FGWBWorkUnitQueue::Peek() const
+{
+	check(NumEntries > 0);
+	const FBucket& Bucket = Buckets[FrontBucketIndex];
+	return Bucket.Entries[Bucket.Head];
+}
+
+void FGWBWorkUnitQueue::Pop()
+{
+	check(NumEntries > 0);
+	FBucket& Bucket = Buckets[FrontBucketIndex];
+	Bucket.Head = (Bucket.Head + 1) & (Bucket.Entries.Num() - 1);
+	Bucket.Num--;
+	NumEntries--;
+
+	// move on to the next bucket with entries
+	if (Bucket.Num == 0)
+	{
+		Bucket.Head = 0;
+		UpdateFrontBucketIndex();
+	}
+}
+
+void FGWBWorkUnitQueue::Reset()
+{
+	for (FBucket& Bucket : Buckets)
+	{
+		Bucket.Head = 0;
+		Bucket.Num = 0;
+	}
+	FrontBucketIndex = 0;
+	NumEntries = 0;
+}
+
+void FGWBWorkUnitQueue::Shrink()
+{
+	Buckets.RemoveAll([](const FBucket& Bucket) { return Bucket.Num == 0; });
+	for (FBucket& Bucket : Buckets)
+	{
+		const int32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(Bucket.Num, 8));
+		if (Capacity < Bucket.Entries.Num())
+		{
+			Bucket.Resize(Capacity);
+		}
+	}
+	Buckets.Shrink();
+	FrontBucketIndex = 0;
+	LastPushedBucketIndex = INDEX_NONE;
+}
+
+SIZE_T FGWBWorkUnitQueue::GetAllocatedSize() const
+{
+	SIZE_T Size = Buckets.GetAllocatedSize();
+	for (const FBucket& Bucket : Buckets)
+	{
+		Size += Bucket.Entries.GetAllocatedSize();
+	}
+	return Size;
+}
+
+void FGWBWorkUnitQueue::UpdateFrontBucketIndex()
+{
+	if (NumEntries == 0)
+	{
+		FrontBucketIndex = 0;
+		return;
+	}
+
+	// buckets before the front one are always empty, so the next one with entries is further back
+	while (Buckets[FrontBucketIndex].Num == 0)
+	{
+		FrontBucketIndex++;
+	}
+}
+
+int32 FGWBWorkUnitQueue::FindOrAddBucket(int32 Priority)
+{
+	// work is usually scheduled in waves with the same priority
+	if (Buckets.IsValidIndex(LastPushedBucketIndex) && Buckets[LastPushedBucketIndex].Priority == Priority)
+	{
+		return LastPushedBucketIndex;
+	}
+
+	const int32 BucketIndex = Algo::LowerBoundBy(Buckets, Priority, [](const FBucket& Bucket) { return Bucket.Priority; });
+	if (Buckets.IsValidIndex(BucketIndex) && Buckets[BucketIndex].Priority == Priority)
+	{
+		return BucketIndex;
+	}
+
+	// first time we see this priority, keep buckets sorted and indices pointing at the same buckets
+	FBucket NewBucket;
+	NewBucket.Priority = Priority;
+	Buckets.Insert(MoveTemp(NewBucket), BucketIndex);
+	if (NumEntries > 0 && BucketIndex <= FrontBucketIndex)
+	{
+		FrontBucketIndex++;
+	}
+	if (LastPushedBucketIndex >= BucketIndex)
+	{
+		LastPushedBucketIndex++;
+	}
+	return BucketIndex;
+}
+
+void FGWBWorkUnitQueue::FBucket::PushBack(const FGWBQueuedWorkUnit& Entry)
+{
+	if (Num == Entries.Num())
+	{
+		Grow();
+	}
+	Entries[(Head + Num) & (Entries.Num() - 1)] = Entry;
+	Num++;
+}
+
+void FGWBWorkUnitQueue::FBucket::PushFront(const FGWBQueuedWorkUnit& Entry)
+{
+	if (Num == Entries.Num())
+	{
+		Grow();
+	}
+	Head = (Head - 1) & (Entries.Num() - 1);
+	Entries[Head] = Entry;
+	Num++;
+}
+
+void FGWBWorkUnitQueue::FBucket::Grow()
+{
+	Resize(FMath::Max(Entries.Num() * 2, 8));
+}
+
+void FGWBWorkUnitQueue::FBucket::Resize(int32 NewCapacity)
+{
+	// unwrap the ring into a buffer of the new size
+	check(NewCapacity >= Num && FMath::IsPowerOfTwo(NewCapacity));
+	TArray<FGWBQueuedWorkUnit> NewEntries;
+	NewEntries.SetNumUninitialized(NewCapacity);
+	for (int32 i = 0; i < Num; i++)
+	{
+		NewEntries[i] = Entries[(Head + i) & (Entries.Num() - 1)];
+	}
+	Entries = MoveTemp(NewEntries);
+	Head = 0;
+}
@@ -1,9 +1,10 @@
 #include "Extensions/Modifiers.h"
 #include "Cvars.h"
+#include "Utils/GWBClock.h"
 
 void FFrameBudgetEscalationModifierImpl::ModifyValueImpl(double& Value)
 {
-	const auto Now = FPlatformTime::Seconds();
+	const auto Now = FGWBClock::Seconds();
 	const auto DeltaTime = Now - LastEscalationUpdateTimestamp;
 	if (TotalNumWorkInstances > (uint32)CVarGWB_EscalationCount.GetValueOnGameThread())
 	{
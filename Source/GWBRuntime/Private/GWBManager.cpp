@@ -1,8 +1,12 @@
 #include "GWBManager.h"
 #include "GWBRuntimeModule.h"
 #include "GWBSubsystem.h"
+#include "GWBTimeSlicersSubsystem.h"
+#include "Components/GWBTimeSlicer.h"
 #include "DataTypes/GWBTimeSlicedLoopScope.h"
 #include "DataTypes/GWBTimeSlicedScope.h"
+#include "DataTypes/GWBStackTimeSlicer.h"
+#include "Utils/GWBClock.h"
 #include "DataTypes/GWBWorkUnitHandle.h"
 #include "Extensions/Modifiers.h"
 #include "Stats.h"
@@ -10,6 +14,26 @@
 
 #define TO_MS_STRING(MS) *FString::Printf(TEXT("%.2fms"), (MS*1000))
 
+namespace
+{
+	/** Entries of units that are gone only get dropped once they reach the front of their lane, so don't let them pile up. */
+	FORCEINLINE bool ShouldCompact(int32 NumStale, int32 Num)
+	{
+		return NumStale > CVarGWB_CompactThreshold.GetValueOnGameThread() && NumStale > Num / 2;
+	}
+
+	template<typename DeadlineType, typename IsStaleFunctorType>
+	void CompactDeadlineWorkUnits(TArray<TGWBDeadlineWorkUnit<DeadlineType>>& DeadlineWorkUnits, int32& NumStale, IsStaleFunctorType IsStale)
+	{
+		if (ShouldCompact(NumStale, DeadlineWorkUnits.Num()))
+		{
+			DeadlineWorkUnits.RemoveAll(IsStale);
+			DeadlineWorkUnits.Heapify();
+			NumStale = 0;
+		}
+	}
+}
+
 UGWBManager::UGWBManager()
 {
 	FGWBWorkGroupDefinition Default;
@@ -24,17 +48,27 @@ void UGWBManager::Initialize(UWorld* ForWorld)
 	Scheduler = NewObject<UGWBScheduler>(ForWorld);
 	
 	// Generate work categories from definitions
+	int32 NumReservedWorkUnits = 0;
 	for (auto& Def : WorkGroupDefinitions)
 	{
 		WorkGroups.Add(FGWBWorkGroup(Def));
+		NumReservedWorkUnits += FMath::Max(Def.NumReservedWorkUnits, 0);
 	}
 
+	// callback records come from a pool shared by all managers, reserve on top of what's already in use
+	FGWBWorkUnitCallbackPool& CallbackPool = FGWBWorkUnitCallbackPool::Get();
+	CallbackPool.Reserve(CallbackPool.GetNumRecordsInUse() + NumReservedWorkUnits);
+
 	ModifierManager.AddBudgetModifier(FFrameBudgetEscalationModifier());
 
 	Scheduler->StartWorkCycleDelegate.BindLambda([&]()
 	{
 		DoWork();
 	});
+	Scheduler->IdleDelegate.BindLambda([&]()
+	{
+		ShrinkIdleWorkGroups();
+	});
 }
 
 TArray<FName> UGWBManager::GetValidGroupNames() const
@@ -48,6 +82,17 @@ TArray<FName> UGWBManager::GetValidGroupNames() const
 	return Names;
 }
 
+SIZE_T UGWBManager::GetAllocatedSize() const
+{
+	SIZE_T Size = WorkGroups.GetAllocatedSize() + WorkGroupsOrder.GetAllocatedSize() + ActiveWorkGroups.GetAllocatedSize();
+	for (const FGWBWorkGroup& WorkGroup : WorkGroups)
+	{
+		Size += WorkGroup.WorkUnits.GetAllocatedSize() + WorkGroup.WorkUnitsQueue.GetAllocatedSize();
+	}
+	Size += DeadlineWorkUnits.GetAllocatedSize() + FrameDeadlineWorkUnits.GetAllocatedSize() + StagedWorkUnits.GetAllocatedSize();
+	return Size;
+}
+
 void UGWBManager::Reset()
 {
 	if (bIsDoingWork)
@@ -63,14 +108,23 @@ void UGWBManager::Reset()
 	if (Scheduler != nullptr) Scheduler->Stop();
 	for (auto ItCategory = WorkGroups.CreateIterator(); ItCategory; ++ItCategory)
 	{
-		for (auto& WorkUnit : ItCategory->WorkUnitsQueue)
+		for (auto& WorkUnit : ItCategory->WorkUnits)
 		{
-			WorkUnit.GetAbortCallback().ExecuteIfBound();
+			if (!WorkUnit.HasWork()) continue;
 			WorkUnit.MarkAborted();
+			WorkUnit.GetAbortCallback().ExecuteIfBound();
 		}
 	}
 	TotalWorkCount = 0;
 	WorkGroups.Reset();
+	WorkGroupsOrder.Reset();
+	ActiveWorkGroups.Reset();
+	NumActiveWorkGroups = 0;
+	DeadlineWorkUnits.Reset();
+	NumStaleDeadlineWorkUnits = 0;
+	FrameDeadlineWorkUnits.Reset();
+	NumStaleFrameDeadlineWorkUnits = 0;
+	StagedWorkUnits.Reset();
 }
 FGWBWorkUnitHandle UGWBManager::ScheduleWork(const UObject* WorldContextObject, const FName WorkGroupId, const FGWBWorkOptions& WorkOptions)
 {
@@ -82,18 +136,13 @@ void UGWBManager::AbortWorkUnit(const UObject* WorldContextObject, FGWBWorkUnitH
 {
 	const UGWBSubsystem* Subsystem = GEngine->GetEngineSubsystem<UGWBSubsystem>();
 	UGWBManager* GlobalManager = Subsystem->GetManager();
-	for (auto ItCategory = GlobalManager->WorkGroups.CreateIterator(); ItCategory; ++ItCategory)
-	{
-		for (auto& WorkUnit : ItCategory->WorkUnitsQueue)
-		{
-			if (WorkUnitHandle.GetId() == WorkUnit.GetId())
-			{
-				WorkUnit.GetAbortCallback().ExecuteIfBound();
-				WorkUnit.MarkAborted();
-				return;
-			}
-		}
-	}
+	GlobalManager->AbortWorkUnit(WorkUnitHandle);
+}
+bool UGWBManager::IsWorkUnitPending(const UObject* WorldContextObject, const FGWBWorkUnitHandle& WorkUnitHandle)
+{
+	const UGWBSubsystem* Subsystem = GEngine->GetEngineSubsystem<UGWBSubsystem>();
+	const UGWBManager* GlobalManager = Subsystem->GetManager();
+	return GlobalManager->IsWorkUnitPending(WorkUnitHandle);
 }
 
 void UGWBManager::BindBlueprintCallback(FGWBWorkUnitHandle& Handle, const FGWBBlueprintWorkDelegate& OnDoWork)
@@ -118,20 +167,24 @@ FGWBWorkUnitHandle UGWBManager::ScheduleWork(const FName& WorkGroupId, const FGW
 	if (!ensureAlwaysMsgf(WorkGroupIndex.IsValidId(), TEXT("ScheduleWorkUnit -> Invalid WorkGroupId: %s"), *WorkGroupId.ToString())) return FGWBWorkUnitHandle::PassthroughHandle();
 	auto& WorkGroup = WorkGroups[WorkGroupIndex];
 	
-	// schedule a unit of work with the provided options and callback
-	const double CurrentTime = FPlatformTime::Seconds();
-	FGWBWorkUnit WorkUnit(WorkOptions, CurrentTime);
-
-	// Figure out the priority index of the work unit
-	const int32 InsertIndex = Algo::LowerBoundBy(WorkGroup.WorkUnitsQueue, WorkUnit,
-		[](const FGWBWorkUnit& ExistingWorkUnit) { return ExistingWorkUnit; },
-		[](const FGWBWorkUnit& ExistingWorkUnit, const FGWBWorkUnit& WorkUnit)
-		{
-			return ExistingWorkUnit.GetEffectivePriority() <= WorkUnit.GetEffectivePriority();
-		});
-
-	// Insert sort the unit of work instance into the group's work unit
-	WorkGroup.WorkUnitsQueue.Insert(WorkUnit, InsertIndex);
+	// schedule a unit of work with the provided options and callback into a free slot of the group
+	const double CurrentTime = FGWBClock::Seconds();
+	const uint64 CurrentFrame = GetFrameCounter();
+	NextWorkUnitId = NextWorkUnitId == MAX_int32 ? 1 : NextWorkUnitId + 1;
+	const int32 SlotIndex = WorkGroup.WorkUnits.Emplace(WorkOptions, CurrentTime, CurrentFrame, NextWorkUnitId);
+	FGWBWorkUnit& WorkUnit = WorkGroup.WorkUnits[SlotIndex];
+	WorkGroup.LastActiveTimestamp = CurrentTime;
+
+	if (ShouldStageWorkUnit(WorkGroupIndex, WorkOptions))
+	{
+		// scheduled from within the work of its own group but not allowed to run in this cycle, hold it back until the work loop is done
+		WorkUnit.SetStaged(true);
+		StagedWorkUnits.Add({ WorkGroupIndex.AsInteger(), SlotIndex, WorkUnit.GetId() });
+	}
+	else
+	{
+		EnqueueWorkUnit(WorkGroupIndex, SlotIndex);
+	}
 	
 	TotalWorkCount++;
 	SET_DWORD_STAT(STAT_GameWorkBalancer_WorkCount, TotalWorkCount);
@@ -147,110 +200,269 @@ FGWBWorkUnitHandle UGWBManager::ScheduleWork(const FName& WorkGroupId, const FGW
 	// allow extensions to react to work scheduling
 	OnWorkScheduled(WorkGroupId);
 
-	return FGWBWorkUnitHandle(WorkUnit);
+	return FGWBWorkUnitHandle(WorkUnit, WorkGroupIndex.AsInteger(), SlotIndex);
 };
+bool UGWBManager::ShouldStageWorkUnit(const FSetElementId WorkGroupIndex, const FGWBWorkOptions& WorkOptions) const
+{
+	// work scheduled for other groups (or outside of any callback) is queued right away and other groups pick it up
+	// later in this cycle if they haven't worked yet
+	if (!bIsDoingWork || WorkGroupIndex != WorkingGroupIndex) return false;
+
+	const bool bCanDoWorkImmediately = CVarGWB_ImmediateDuringWork.GetValueOnGameThread()
+		&& WorkGroups[WorkGroupIndex].Def.bMutableWhileRunning
+		&& !WorkOptions.bDeferToNextFrame;
+	return !bCanDoWorkImmediately;
+}
+void UGWBManager::EnqueueWorkUnit(const FSetElementId WorkGroupIndex, const int32 SlotIndex)
+{
+	auto& WorkGroup = WorkGroups[WorkGroupIndex];
+	const FGWBWorkUnit& WorkUnit = WorkGroup.WorkUnits[SlotIndex];
+	const FGWBWorkOptions& WorkOptions = WorkUnit.Options;
+
+	if (WorkOptions.MaxNumSkippedFrames > 0)
+	{
+		// Work that may only skip so many frames is also tracked by the frame it has to be forced on,
+		// until then it waits for budget in its group queue or the deadline lane like any other work
+		FrameDeadlineWorkUnits.HeapPush({ WorkUnit.ScheduledFrame + WorkOptions.MaxNumSkippedFrames + 1, WorkGroupIndex.AsInteger(), SlotIndex, WorkUnit.GetId() });
+	}
+
+	if (WorkOptions.MaxDelay > 0.f)
+	{
+		// Work with a deadline goes into the cross-group earliest-deadline-first lane
+		DeadlineWorkUnits.HeapPush({ FGWBClock::ToCycles(WorkUnit.ScheduledTimestamp + WorkOptions.MaxDelay), WorkGroupIndex.AsInteger(), SlotIndex, WorkUnit.GetId() });
+		WorkGroup.NumWorkUnitsWithMaxDelay++;
+	}
+	else
+	{
+		// Queue the unit of work into the bucket of its priority (in front of or behind the units with the same priority)
+		const int32 Priority = WorkUnit.GetEffectivePriority();
+		WorkGroup.WorkUnitsQueue.Push({ SlotIndex, WorkUnit.GetId(), WorkUnit.QueueSerial }, Priority, WorkOptions.bAddToFrontOfPriorityQueue);
+		UpdateWorkGroupActivity(WorkGroupIndex);
+	}
+}
+void UGWBManager::MergeStagedWorkUnits()
+{
+	for (const FGWBStagedWorkUnit& StagedWorkUnit : StagedWorkUnits)
+	{
+		// units aborted while staged are already gone
+		const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(StagedWorkUnit.GroupIndex);
+		FGWBWorkUnit* WorkUnit = WorkGroups.IsValidId(WorkGroupIndex) ? WorkGroups[WorkGroupIndex].FindWorkUnit(StagedWorkUnit.SlotIndex, StagedWorkUnit.WorkUnitId) : nullptr;
+		if (!WorkUnit) continue;
+
+		WorkUnit->SetStaged(false);
+		EnqueueWorkUnit(WorkGroupIndex, StagedWorkUnit.SlotIndex);
+	}
+	StagedWorkUnits.Reset();
+}
+void UGWBManager::UpdateWorkGroupActivity(const FSetElementId WorkGroupIndex)
+{
+	const int32 Index = WorkGroupIndex.AsInteger();
+	if (Index >= ActiveWorkGroups.Num())
+	{
+		ActiveWorkGroups.Add(false, Index + 1 - ActiveWorkGroups.Num());
+	}
+
+	const bool bIsActive = !WorkGroups[WorkGroupIndex].WorkUnitsQueue.IsEmpty();
+	if (ActiveWorkGroups[Index] != bIsActive)
+	{
+		ActiveWorkGroups[Index] = bIsActive;
+		NumActiveWorkGroups += bIsActive ? 1 : -1;
+	}
+}
+bool UGWBManager::AbortWorkUnit(const FGWBWorkUnitHandle& WorkUnitHandle)
+{
+	const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(WorkUnitHandle.GetGroupIndex());
+	if (!WorkGroups.IsValidId(WorkGroupIndex)) return false;
+	auto& WorkGroup = WorkGroups[WorkGroupIndex];
+
+	FGWBWorkUnit* WorkUnit = WorkGroup.FindWorkUnit(WorkUnitHandle.GetSlotIndex(), WorkUnitHandle.GetId());
+	if (!WorkUnit) return false;
+
+	UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::AbortWorkUnit\t-> Group: %s, Instance %d"), *WorkGroup.Def.Id.ToString(), WorkUnit->GetId());
+
+	// free the slot right away, the queue entries pointing at it are dropped once the work loop reaches them
+	WorkUnit->MarkAborted();
+	const FGWBWorkUnitCallbackRef Callback = WorkUnit->CallbackHandle;
+	RetireWorkUnit(WorkGroupIndex, WorkUnitHandle.GetSlotIndex());
+
+	Callback->AbortCallback.ExecuteIfBound();
+	return true;
+}
+bool UGWBManager::SetWorkUnitPriorityOffset(const FGWBWorkUnitHandle& WorkUnitHandle, const int32 PriorityOffset)
+{
+	const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(WorkUnitHandle.GetGroupIndex());
+	if (!WorkGroups.IsValidId(WorkGroupIndex)) return false;
+	auto& WorkGroup = WorkGroups[WorkGroupIndex];
+	FGWBWorkUnit* WorkUnit = WorkGroup.FindWorkUnit(WorkUnitHandle.GetSlotIndex(), WorkUnitHandle.GetId());
+	if (!WorkUnit) return false;
+	if (WorkUnit->PriorityOffset == PriorityOffset) return true;
+
+	WorkUnit->PriorityOffset = PriorityOffset;
+
+	// units in the deadline lane are ordered by deadline and staged units get queued with their new priority later,
+	// a queued unit leaves its old entry behind as a tombstone and is queued again behind the units of its new priority,
+	// the new serial keeps the old entry a tombstone even if the unit gets its old priority back later
+	if (WorkUnit->IsStaged() || WorkUnit->Options.MaxDelay > 0.f) return true;
+	const int32 Priority = WorkUnit->GetEffectivePriority();
+	WorkGroup.WorkUnitsQueue.Push({ WorkUnitHandle.GetSlotIndex(), WorkUnit->GetId(), ++WorkUnit->QueueSerial }, Priority);
+	WorkGroup.NumStaleQueuedWorkUnits++;
+
+	UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::SetWorkUnitPriorityOffset\t-> Group: %s, Instance %d, Priority: %d"), *WorkGroup.Def.Id.ToString(), WorkUnit->GetId(), Priority);
+	return true;
+}
+bool UGWBManager::IsWorkUnitPending(const FGWBWorkUnitHandle& WorkUnitHandle) const
+{
+	const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(WorkUnitHandle.GetGroupIndex());
+	if (!WorkGroups.IsValidId(WorkGroupIndex)) return false;
+	const auto& WorkUnits = WorkGroups[WorkGroupIndex].WorkUnits;
+	const int32 SlotIndex = WorkUnitHandle.GetSlotIndex();
+	return WorkUnits.IsValidIndex(SlotIndex) && WorkUnits[SlotIndex].GetId() == WorkUnitHandle.GetId() && WorkUnits[SlotIndex].HasWork();
+}
 void UGWBManager::DoWork()
 {
 	SCOPE_CYCLE_COUNTER(STAT_DoWorkForFrame);
 
-	// allow extensions to plug in to modify the frame budget
-	double FrameBudget = (double)CVarGWB_FrameBudget.GetValueOnGameThread();
-	ApplyBudgetModifiers(FrameBudget);
-	int WorkCountBudget = CVarGWB_WorkCountBudget.GetValueOnGameThread();
+	// budgets are fixed for the whole cycle, so escalation advances once per frame no matter how many groups work
+	NotifyWorkScheduled();
+	const FGWBWorkCycleBudget Budget = MakeWorkCycleBudget();
+
+	// resolved once per cycle, the work loops hand it to their scopes directly instead of looking it up for every unit of work.
+	// The slicer is evicted from its registry when the balancer goes idle for long enough, then it's looked up by name again
+	WorkBalancerTimeSlicer = UGWBTimeSlicersSubsystem::GetTimeSlicer(this, WorkBalancerTimeSlicerHandle);
+	if (!WorkBalancerTimeSlicer)
+	{
+		WorkBalancerTimeSlicerHandle = UGWBTimeSlicer::GetHandle(this, FName("GameplayWorkBalancer"));
+		WorkBalancerTimeSlicer = UGWBTimeSlicersSubsystem::GetTimeSlicer(this, WorkBalancerTimeSlicerHandle);
+	}
 
 	// when this struct goes out of scope it's destructor will reset the time slicer we use to budget the gameplay work balancer
-	FGWBTimeSlicedScope TimeSlicer(this, FName("GameplayWorkBalancer"), FrameBudget, WorkCountBudget);
+	FGWBTimeSlicedScope TimeSlicer(WorkBalancerTimeSlicer, Budget.FrameBudget, Budget.WorkCountBudget);
 
-	const double TimeSinceLastWork = FPlatformTime::Seconds() - TimeSlicer.GetLastResetTimestamp();
+	const double TimeSinceLastWork = FGWBClock::Seconds() - TimeSlicer.GetLastResetTimestamp();
 	OnBeforeDoWorkDelegate.Broadcast(TimeSinceLastWork);
 	bIsDoingWork = true;
 
-	// TODO: this can be optimized as in original implementation by doing the counts in the Scheduling Functions
-	TSet<FName> WorkGroupsWithWork;
-	for (auto Group : WorkGroups)
-	{
-		if (Group.WorkUnitsQueue.Num() > 0)
-		{
-			WorkGroupsWithWork.Add(Group.Def.Id);
-		}
-	}
+	// Do work that can't skip any more frames first, no matter the budget
+	DoWorkForSkippedFrames(Budget);
+
+	// Do work that has a deadline next, in deadline order across all groups
+	DoWorkForDeadlines(Budget);
 
 	// Do work for each group
 	{
 		SCOPE_CYCLE_COUNTER(STAT_DoWorkForFrame_Groups);
 
 		UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWork\t-> START\t(NumGroups: %d, GlobalWorkCount: %d, TimeBudget: %s)"),
-			WorkGroupsWithWork.Num(),
+			NumActiveWorkGroups,
 			TotalWorkCount,
-			TO_MS_STRING(FrameBudget)
+			TO_MS_STRING(Budget.FrameBudget)
 		);
 
-		uint32 i = 0;
-		for (auto& WorkGroup : WorkGroups)
+		// groups may have been added or changed priority since the last cycle sorted them
+		if (bIsWorkGroupsOrderDirty || WorkGroupsOrder.Num() != WorkGroups.Num())
 		{
-			// if there's no work to be done, skip this group
-			if (WorkGroup.WorkUnitsQueue.Num() == 0) continue;
+			SortWorkGroups();
+		}
 
-			if (TimeSlicer.IsOverBudget())
+		for (const FSetElementId WorkGroupIndex : WorkGroupsOrder)
+		{
+			// no group has anything queued (work scheduled from callbacks re-activates its group), we're done
+			if (NumActiveWorkGroups == 0) break;
+
+			// if there's no work to be done (tombstones are dropped for free if the group gets to work), skip this group
+			if (!IsWorkGroupActive(WorkGroupIndex)) continue;
+			auto& WorkGroup = WorkGroups[WorkGroupIndex];
+
+			// decide whether this group works this frame according to its skip policy
+			const FGWBWorkGroupDefinition& Def = WorkGroup.Def;
+			const bool bHasSkipLimit = Def.bCanSkipFrame && Def.MaxNumSkippedFrames > 0;
+			const bool bMustDoWork = bHasSkipLimit && WorkGroup.NumSkippedFrames >= Def.MaxNumSkippedFrames;
+			const TCHAR* SkipReason = nullptr;
+			if (!bMustDoWork)
 			{
-				UE_LOG(Log_GameplayWorkBalancer, Log, TEXT("UGWBManager::DoWork\t-> OVER BUDGET\t - Skip Group: %s (NumSkippedFrames: %d MaxNumSkippedFrames: %d)"), *WorkGroup.Def.Id.ToString(), WorkGroup.NumSkippedFrames, WorkGroup.Def.MaxNumSkippedFrames);
-				WorkGroup.NumSkippedFrames++;
-				// if we skipped work for this group, use it's configuration to control how much to escalate it's own priority when skipped
-				WorkGroup.PriorityOffset += WorkGroup.Def.SkipPriorityDelta;
+				if (Def.bCanSkipFrame && Def.bAlwaysSkipUntilMax && bHasSkipLimit)
+				{
+					SkipReason = TEXT("SKIP UNTIL MAX");
+				}
+				else if (Def.bCanSkipFrame && Def.bSkipUnlessFirstInFrame && TimeSlicer.GetWorkUnitsCompleted() > 0)
+				{
+					SkipReason = TEXT("NOT FIRST IN FRAME");
+				}
+				else if (TimeSlicer.IsOverBudget())
+				{
+					SkipReason = TEXT("OVER BUDGET");
+				}
+			}
 
-				// Track deferred work groups
-				for (int32 j = i; j < WorkGroup.WorkUnitsQueue.Num(); j++)
+			// Do work for group, a group that may not skip any more frames gets at least one unit done regardless of budget
+			if (!SkipReason)
+			{
+				const int32 NumWorkUnitsDone = DoWorkForGroup(WorkGroupIndex, Budget, bMustDoWork);
+				UpdateWorkGroupActivity(WorkGroupIndex);
+				if (NumWorkUnitsDone > 0)
 				{
-					OnWorkGroupDeferred(WorkGroup.Def.Id);
+					WorkGroup.NumSkippedFrames = 0;
+					SetWorkGroupPriorityOffset(WorkGroup, 0);
+					continue;
 				}
-				
-				break;
+
+				SkipReason = TEXT("OVER BUDGET");
 			}
 
-			// Do work for group and record when work was completed
-			WorkGroup.NumSkippedFrames = 0;
-			WorkGroup.PriorityOffset = 0;
-			DoWorkForGroup(WorkGroup);
+			// the queue only holds tombstones
+			if (WorkGroup.GetNumQueuedWorkUnits() == 0) continue;
 
-			i++;
+			UE_LOG(Log_GameplayWorkBalancer, Verbose, TEXT("UGWBManager::DoWork\t-> %s\t - Skip Group: %s (NumSkippedFrames: %d MaxNumSkippedFrames: %d)"), SkipReason, *Def.Id.ToString(), WorkGroup.NumSkippedFrames, Def.MaxNumSkippedFrames);
+			WorkGroup.NumSkippedFrames++;
+			// if we skipped work for this group, use it's configuration to control how much to escalate it's own priority when skipped
+			SetWorkGroupPriorityOffset(WorkGroup, WorkGroup.PriorityOffset + Def.SkipPriorityDelta);
+
+			// Track deferred work groups, once per group with the number of its deferred units
+			OnWorkGroupDeferred(Def.Id, WorkGroup.GetNumQueuedWorkUnits());
 		}
 
-		double TimeSpent = FPlatformTime::Seconds() - TimeSlicer.GetLastResetTimestamp();
+		double TimeSpent = FGWBClock::Seconds() - TimeSlicer.GetLastResetTimestamp();
 		UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWork\t-> END\t\t(NumGroups: %d, WorkUnitsDoneThisCycle: %d, TimeSpent: %s)"),
-			WorkGroupsWithWork.Num(),
+			NumActiveWorkGroups,
 			TimeSlicer.GetWorkUnitsCompleted(),
 			TO_MS_STRING(TimeSpent)
 		);
 	}
 
+	// Queue the work that was scheduled re-entrantly but has to wait for the next cycle
+	MergeStagedWorkUnits();
+
+	// Drop piled up tombstones and release memory of groups that went idle
+	{
+		SCOPE_CYCLE_COUNTER(STAT_DoWorkForFrame_Compact);
+		CompactWorkUnitQueues();
+		ShrinkIdleWorkGroups();
+	}
+
 	// Handle work group priority changes
 	{
 		SCOPE_CYCLE_COUNTER(STAT_DoWorkForFrame_Reprioritize);
 		
-		// // Apply priority modifiers
-		// for (auto& WorkGroup : WorkGroups)
-		// {
-		// 	int32 Priority = WorkGroup.GetPriority();
-		// 	for (const auto& Modifier : PriorityModifiers)
-		// 	{
-		// 		if (Modifier.GetInterface())
-		// 		{
-		// 			Modifier->ModifyGroupPriority(WorkGroup.Def.Id, Priority);
-		// 		}
-		// 	}
-		// 	// Update priority offset based on modifiers
-		// 	int32 BaseOffset = Priority - WorkGroup.Def.Priority;
-		// 	// Only update if there was a change from modifiers (preserve the SkipPriorityDelta changes)
-		// 	if (BaseOffset != 0)
-		// 	{
-		// 		WorkGroup.PriorityOffset = BaseOffset;
-		// 	}
-		// }
-		
-		// Sort work groups by modified priority
-		WorkGroups.Sort([&](const FGWBWorkGroup& A, const FGWBWorkGroup& B){
-			return A.GetPriority() < B.GetPriority();
-		});
+		// Apply priority modifiers, groups whose modified priority didn't change keep their place. The modifiers for all
+		// groups run once per cycle (so stateful ones advance once per frame) and their result offsets every group
+		if (ModifierManager.HasPriorityModifiers())
+		{
+			double GlobalPriorityOffset = 0.0;
+			ModifierManager.ProcessPriorityModifiers(GlobalPriorityOffset);
+			for (auto& WorkGroup : WorkGroups)
+			{
+				const int32 Priority = WorkGroup.Def.Priority + WorkGroup.PriorityOffset;
+				double ModifiedPriority = (double)Priority + GlobalPriorityOffset;
+				ModifierManager.ProcessGroupPriorityModifiers(WorkGroup.Def.Id, ModifiedPriority);
+				SetWorkGroupPriorityModifierOffset(WorkGroup, FMath::RoundToInt(ModifiedPriority) - Priority);
+			}
+		}
+
+		// Sort work groups by modified priority, only if any of them changed
+		if (bIsWorkGroupsOrderDirty)
+		{
+			SortWorkGroups();
+		}
 	}
 
 	bIsDoingWork = false;
@@ -268,137 +480,412 @@ void UGWBManager::DoWork()
 		ModifierManager.NotifyWorkDeferred(TotalWorkCount);
 		Scheduler->Start();
 	}
+	else if (CVarGWB_ShrinkDelay.GetValueOnGameThread() >= 0.f)
+	{
+		// no more cycles until more work is scheduled, so check back once the burst has been idle long enough
+		Scheduler->StartIdleTimer(CVarGWB_ShrinkDelay.GetValueOnGameThread());
+	}
 };
-void UGWBManager::DoWorkForGroup(FGWBWorkGroup& WorkGroup)
+FGWBWorkCycleBudget UGWBManager::MakeWorkCycleBudget()
+{
+	// allow extensions to plug in to modify the frame budget
+	FGWBWorkCycleBudget Budget;
+	Budget.FrameBudget = (double)CVarGWB_FrameBudget.GetValueOnGameThread();
+	ApplyBudgetModifiers(Budget.FrameBudget);
+	Budget.WorkCountBudget = CVarGWB_WorkCountBudget.GetValueOnGameThread();
+	return Budget;
+}
+void UGWBManager::DoWorkForSkippedFrames(const FGWBWorkCycleBudget& Budget)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DoWorkForFrame_SkippedFrames);
+
+	const uint64 CurrentFrame = GetFrameCounter();
+	int32 NumWorkUnitsDone = 0;
+	while (FrameDeadlineWorkUnits.Num() > 0)
+	{
+		const FGWBFrameDeadlineWorkUnit FrameDeadlineWorkUnit = FrameDeadlineWorkUnits.HeapTop();
+		const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(FrameDeadlineWorkUnit.GroupIndex);
+
+		// drop units that were aborted or already done by their group or the deadline lane
+		const FGWBWorkUnit* WorkUnitPtr = WorkGroups.IsValidId(WorkGroupIndex) ? WorkGroups[WorkGroupIndex].FindWorkUnit(FrameDeadlineWorkUnit.SlotIndex, FrameDeadlineWorkUnit.WorkUnitId) : nullptr;
+		if (!WorkUnitPtr)
+		{
+			FrameDeadlineWorkUnits.HeapPopDiscard();
+			NumStaleFrameDeadlineWorkUnits--;
+			continue;
+		}
+		const FGWBWorkUnit& WorkUnit = *WorkUnitPtr;
+
+		// every other unit still has frames it may skip
+		if (FrameDeadlineWorkUnit.Deadline > CurrentFrame) break;
+
+		// this unit is forced regardless of budget, but it still uses up budget for the rest of the work this frame
+		const uint64 StartWorkCycles = FGWBClock::Cycles();
+		FGWBTimeSlicedLoopScope TimeSlicedWork(WorkBalancerTimeSlicer, Budget.FrameBudget, Budget.WorkCountBudget, StartWorkCycles); // budget for all work
+
+		const uint64 ScheduledFrame = WorkUnit.ScheduledFrame;
+		DoWorkForUnit(WorkUnit, FGWBWorkUnitHandle(WorkUnit, FrameDeadlineWorkUnit.GroupIndex, FrameDeadlineWorkUnit.SlotIndex), StartWorkCycles);
+		const uint64 EndWorkCycles = FGWBClock::Cycles();
+		TimeSlicedWork.EndWork(EndWorkCycles);
+
+		// the callback may have scheduled more work which moves the heap around,
+		// so our entry is left in place and dropped as stale once it's on top
+		RetireWorkUnit(WorkGroupIndex, FrameDeadlineWorkUnit.SlotIndex);
+		NumWorkUnitsDone++;
+
+		UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWorkForSkippedFrames \"%s\"\t -> Forced Instance %d\t(scheduled frame: %llu, current frame: %llu, global: %d), Delta: %s"),
+			*WorkGroups[WorkGroupIndex].Def.Id.ToString(),
+			FrameDeadlineWorkUnit.WorkUnitId,
+			ScheduledFrame,
+			CurrentFrame,
+			TotalWorkCount,
+			TO_MS_STRING(FGWBClock::ToSeconds(EndWorkCycles - StartWorkCycles))
+		);
+	}
+
+	// modifiers hear about completed work once per lane instead of once per unit
+	if (NumWorkUnitsDone > 0)
+	{
+		ModifierManager.NotifyWorkComplete(TotalWorkCount);
+	}
+}
+void UGWBManager::DoWorkForDeadlines(const FGWBWorkCycleBudget& Budget)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DoWorkForFrame_Deadlines);
+
+	int32 NumWorkUnitsDone = 0;
+	while (DeadlineWorkUnits.Num() > 0)
+	{
+		const FGWBDeadlineWorkUnit DeadlineWorkUnit = DeadlineWorkUnits.HeapTop();
+		const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(DeadlineWorkUnit.GroupIndex);
+		
+		// drop aborted (or already forced) units without doing their work or using up any budget
+		const FGWBWorkUnit* WorkUnitPtr = WorkGroups.IsValidId(WorkGroupIndex) ? WorkGroups[WorkGroupIndex].FindWorkUnit(DeadlineWorkUnit.SlotIndex, DeadlineWorkUnit.WorkUnitId) : nullptr;
+		if (!WorkUnitPtr)
+		{
+			DeadlineWorkUnits.HeapPopDiscard();
+			NumStaleDeadlineWorkUnits--;
+			continue;
+		}
+		const FGWBWorkUnit& WorkUnit = *WorkUnitPtr;
+
+		// this scoped struct will increment the time slicer within this for loop, the same timestamp is used for the budget checks
+		const uint64 StartWorkCycles = FGWBClock::Cycles();
+		FGWBTimeSlicedLoopScope TimeSlicedWork(WorkBalancerTimeSlicer, Budget.FrameBudget, Budget.WorkCountBudget, StartWorkCycles); // budget for all work
+
+		// BREAK if we're out of budget, unless the earliest deadline has passed in which case the work is forced
+		const bool bIsOverdue = StartWorkCycles >= DeadlineWorkUnit.Deadline;
+		if (TimeSlicedWork.IsOverBudget(StartWorkCycles) && !bIsOverdue)
+		{
+			UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWorkForDeadlines\t -> OVER BUDGET, WorkUnits Remaining: %d"), GetNumWorkUnitsWithMaxDelay());
+			break;
+		}
+
+		DoWorkForUnit(WorkUnit, FGWBWorkUnitHandle(WorkUnit, DeadlineWorkUnit.GroupIndex, DeadlineWorkUnit.SlotIndex), StartWorkCycles);
+		const uint64 EndWorkCycles = FGWBClock::Cycles();
+		TimeSlicedWork.EndWork(EndWorkCycles);
+
+		// the callback may have scheduled more work which moves the heap and the slots around,
+		// so our entry is left in place and dropped as stale once it's on top
+		RetireWorkUnit(WorkGroupIndex, DeadlineWorkUnit.SlotIndex);
+		NumWorkUnitsDone++;
+
+		UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWorkForDeadlines \"%s\"\t -> Completed Instance %d\t(overdue: %d, remaining: %d, global: %d), Delta: %s"),
+			*WorkGroups[WorkGroupIndex].Def.Id.ToString(),
+			DeadlineWorkUnit.WorkUnitId,
+			bIsOverdue,
+			GetNumWorkUnitsWithMaxDelay(),
+			TotalWorkCount,
+			TO_MS_STRING(FGWBClock::ToSeconds(EndWorkCycles - StartWorkCycles))
+		);
+	}
+
+	// modifiers hear about completed work once per lane instead of once per unit
+	if (NumWorkUnitsDone > 0)
+	{
+		ModifierManager.NotifyWorkComplete(TotalWorkCount);
+	}
+}
+int32 UGWBManager::DoWorkForGroup(const FSetElementId WorkGroupIndex, const FGWBWorkCycleBudget& Budget, const bool bMustDoWork)
 {
 	SCOPE_CYCLE_COUNTER(STAT_DoWorkForGroup);
 
-	// when this struct goes out of scope it's destructor will reset the time slicer we use to budget the group
-	FGWBTimeSlicedScope GroupTimeSliceHandle(this, WorkGroup.Def.Id);
-	
-	// allow extensions to plug in to modify the frame budget
-	double FrameBudget = (double)CVarGWB_FrameBudget.GetValueOnGameThread();
-	ApplyBudgetModifiers(FrameBudget);
-	int WorkCountBudget = CVarGWB_WorkCountBudget.GetValueOnGameThread();
+	auto& WorkGroup = WorkGroups[WorkGroupIndex];
 
-	// Apply group-specific budget modifiers
+	// Apply group-specific budget modifiers, a group works at most once per cycle so they run once per frame too
 	double GroupTimeBudget = WorkGroup.Def.MaxFrameBudget;
-	int32 GroupUnitCount = WorkGroup.Def.MaxWorkUnitsPerFrame;
-	ApplyGroupBudgetModifiers(WorkGroup.Def.Id, GroupTimeBudget, GroupUnitCount);
+	ApplyGroupBudgetModifiers(WorkGroup.Def.Id, GroupTimeBudget);
+
+	// the group budget only lives for this call, so it's budgeted on the stack rather than through a registered slicer
+	FGWBStackTimeSlicer GroupTimeSlicer(GroupTimeBudget, WorkGroup.Def.MaxWorkUnitsPerFrame);
 
-	for (int32 i = 0; i < WorkGroup.WorkUnitsQueue.Num(); i++)
+	int32 NumWorkUnitsDone = 0;
+	while (!WorkGroup.WorkUnitsQueue.IsEmpty())
 	{
-		// this scoped struct will increment the time slicer within this for loop
-		FGWBTimeSlicedLoopScope TimeSlicedGroupWork(this, WorkGroup.Def.Id, GroupTimeBudget, GroupUnitCount); // budget for group
-		FGWBTimeSlicedLoopScope TimeSlicedWork(this, FName("GameplayWorkBalancer"), FrameBudget, WorkCountBudget); // budget for all work
+		const FGWBQueuedWorkUnit QueuedWorkUnit = WorkGroup.WorkUnitsQueue.Peek();
 
-		auto& WorkUnit = WorkGroup.WorkUnitsQueue[i];
+		// drop tombstones of aborted (or already done) units without using up any budget
+		const FGWBWorkUnit* WorkUnitPtr = WorkGroup.FindWorkUnit(QueuedWorkUnit);
+		if (!WorkUnitPtr)
+		{
+			WorkGroup.WorkUnitsQueue.Pop();
+			WorkGroup.NumStaleQueuedWorkUnits--;
+			continue;
+		}
+		const FGWBWorkUnit& WorkUnit = *WorkUnitPtr;
+
+		// this scoped struct will increment the time slicer within this for loop, the same timestamp is used for the budget checks
+		const uint64 StartWorkCycles = FGWBClock::Cycles();
+		FGWBTimeSlicedLoopScope TimeSlicedWork(WorkBalancerTimeSlicer, Budget.FrameBudget, Budget.WorkCountBudget, StartWorkCycles); // budget for all work
 
 		// START budget checks
+		// the first unit of a group that must do work this frame only has to fit the group budget
+		const bool bIgnoreFrameBudget = bMustDoWork && NumWorkUnitsDone == 0;
+
 		// BREAK if we've reached MAX count of units of work in this group allowed
-		if (TimeSlicedGroupWork.IsOverUnitCountBudget() ||
-			TimeSlicedWork.IsOverUnitCountBudget())
+		if (GroupTimeSlicer.HasWorkUnitCountBudgetBeenExceeded() ||
+			(!bIgnoreFrameBudget && TimeSlicedWork.IsOverUnitCountBudget()))
 		{
 			UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWorkForGroup \"%s\"\t -> OVER GROUP UNIT COUNT BUDGET, WorkUnits Remaining: %d"),
 				*WorkGroup.Def.Id.ToString(),
-				WorkGroup.WorkUnitsQueue.Num());
+				WorkGroup.GetNumQueuedWorkUnits());
 				
-			// Track deferred work units
-			for (int32 j = i; j < WorkGroup.WorkUnitsQueue.Num(); j++)
-			{
-				OnWorkUnitDeferred(WorkGroup.Def.Id);
-			}
+			// Track deferred work units, once per group with the number of units left
+			OnWorkUnitsDeferred(WorkGroup.Def.Id, WorkGroup.GetNumQueuedWorkUnits());
 			
 			break;
 		}
 
 		// BREAK if we've run out of time budget for this group
-		if (TimeSlicedGroupWork.IsOverFrameTimeBudget() ||
-			TimeSlicedWork.IsOverFrameTimeBudget())
+		if (GroupTimeSlicer.HasFrameBudgetBeenExceeded(StartWorkCycles) ||
+			(!bIgnoreFrameBudget && TimeSlicedWork.IsOverFrameTimeBudget(StartWorkCycles)))
 		{
 			UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWorkForGroup \"%s\"\t -> OVER GROUP TIME BUDGET, WorkUnits Remaining: %d"),
 				*WorkGroup.Def.Id.ToString(),
-				WorkGroup.WorkUnitsQueue.Num());
+				WorkGroup.GetNumQueuedWorkUnits());
 			
-			const double StartWorkTimestamp = FPlatformTime::Seconds();
-			const double TimeElapsedSinceScheduled = StartWorkTimestamp - WorkUnit.ScheduledTimestamp;
-			const bool HasUnitExceedMaxIdleTime = WorkUnit.Options.MaxDelay > 0 && TimeElapsedSinceScheduled > WorkUnit.Options.MaxDelay;
-			// TODO: Don't use max delay directly, as that could cause all instances scheduled at the same time to also do work at the same time
-			if (!HasUnitExceedMaxIdleTime)
-			{
-				// Track deferred work units
-				for (int32 j = i; j < WorkGroup.WorkUnitsQueue.Num(); j++)
-				{
-					OnWorkUnitDeferred(WorkGroup.Def.Id);
-				}
-				
-				break; // BREAK if we've run out of time budget for this group
-			}
+			// Track deferred work units, once per group with the number of units left
+			OnWorkUnitsDeferred(WorkGroup.Def.Id, WorkGroup.GetNumQueuedWorkUnits());
+			
+			break; // BREAK if we've run out of time budget for this group
 		}
 		// END budget checks
 		
-		// Skip instance if aborted
-		if (WorkUnit.HasWork())
-		{
-			const double StartWorkTimestamp = FPlatformTime::Seconds();
-			DoWorkForUnit(WorkUnit);
-			const double EndWorkTimestamp = FPlatformTime::Seconds();
-			const double UnitWorkDeltaTime = EndWorkTimestamp - StartWorkTimestamp;
-
-			TotalWorkCount--;
-			SET_DWORD_STAT(STAT_GameWorkBalancer_WorkCount, TotalWorkCount);
-	
-			ModifierManager.NotifyWorkComplete(TotalWorkCount);
-			
-			UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWorkForGroup \"%s\"\t -> Completed Instance %d\t(remaining: %d, global: %d), Start: %.3f, End: %.3f, Delta: %s, Avg: %s, RemainingTimeInBudget: %s"),
-				*WorkGroup.Def.Id.ToString(),
-				WorkUnit.GetId(),
-				WorkGroup.WorkUnitsQueue.Num() - (WorkUnit.HasWork() ? 0 : 1),
-				TotalWorkCount,
-				StartWorkTimestamp,
-				EndWorkTimestamp,
-				TO_MS_STRING(UnitWorkDeltaTime),
-				TO_MS_STRING(WorkGroup.AverageUnitTime),
-				TO_MS_STRING(TimeSlicedWork.GetRemainingTimeInBudget())
-			);
-		}
+		DoWorkForUnit(WorkUnit, FGWBWorkUnitHandle(WorkUnit, WorkGroupIndex.AsInteger(), QueuedWorkUnit.SlotIndex), StartWorkCycles);
+		const uint64 EndWorkCycles = FGWBClock::Cycles();
+		TimeSlicedWork.EndWork(EndWorkCycles);
+		GroupTimeSlicer.EndWork();
+		const double UnitWorkDeltaTime = FGWBClock::ToSeconds(EndWorkCycles - StartWorkCycles);
+
+		// the callback may have scheduled more work into this group which moves the queue and the slots around,
+		// so our entry is left in place as a tombstone and dropped once it's in front
+		RetireWorkUnit(WorkGroupIndex, QueuedWorkUnit.SlotIndex);
+		WorkGroup.LastActiveTimestamp = FGWBClock::ToSeconds(EndWorkCycles);
+		NumWorkUnitsDone++;
+		
+		UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::DoWorkForGroup \"%s\"\t -> Completed Instance %d\t(remaining: %d, global: %d), Start: %.3f, End: %.3f, Delta: %s, Avg: %s, RemainingTimeInBudget: %s"),
+			*WorkGroup.Def.Id.ToString(),
+			QueuedWorkUnit.WorkUnitId,
+			WorkGroup.GetNumQueuedWorkUnits(),
+			TotalWorkCount,
+			FGWBClock::ToSeconds(StartWorkCycles),
+			FGWBClock::ToSeconds(EndWorkCycles),
+			TO_MS_STRING(UnitWorkDeltaTime),
+			TO_MS_STRING(WorkGroup.AverageUnitTime),
+			TO_MS_STRING(TimeSlicedWork.GetRemainingTimeInBudget())
+		);
+	}
 
-		if (!WorkUnit.HasWork())
-		{
-			if (WorkUnit.Options.MaxDelay > 0.f)
-			{
-				WorkGroup.NumWorkUnitsWithMaxDelay--;
-			}
-			WorkGroup.WorkUnitsQueue.RemoveAt(i, 1, EAllowShrinking::No);
-			i--;
-		}
+	// modifiers hear about completed work once per group instead of once per unit
+	if (NumWorkUnitsDone > 0)
+	{
+		ModifierManager.NotifyWorkComplete(TotalWorkCount);
+		ModifierManager.NotifyGroupWorkComplete(WorkGroup.Def.Id, WorkGroup.WorkUnits.Num());
 	}
+
+	return NumWorkUnitsDone;
 };
-void UGWBManager::DoWorkForUnit(const FGWBWorkUnit& WorkUnit) const
+void UGWBManager::DoWorkForUnit(const FGWBWorkUnit& WorkUnit, const FGWBWorkUnitHandle& WorkUnitHandle, const uint64 StartWorkCycles)
 {
 	SCOPE_CYCLE_COUNTER(STAT_DoWorkForUnit);
-	const double StartInstanceTime = FPlatformTime::Seconds();
+	const double StartInstanceTime = FGWBClock::ToSeconds(StartWorkCycles);
 	const float TimeSinceScheduled = static_cast<float>(StartInstanceTime - WorkUnit.ScheduledTimestamp);
 
-	// do the work!
-	WorkUnit.GetWorkCallback().ExecuteIfBound(TimeSinceScheduled, FGWBWorkUnitHandle(WorkUnit));
+	// mark completed up front so the unit can't be aborted from within its own callback,
+	// and do the work through the handle since it keeps the callback alive even if the unit moves
 	WorkUnit.MarkCompleted();
+	WorkingGroupIndex = FSetElementId::FromInteger(WorkUnitHandle.GetGroupIndex());
+	WorkUnitHandle.GetWorkCallback().ExecuteIfBound(TimeSinceScheduled, WorkUnitHandle);
+	WorkingGroupIndex = FSetElementId();
 };
 
+void UGWBManager::RetireWorkUnit(const FSetElementId WorkGroupIndex, const int32 SlotIndex)
+{
+	auto& WorkGroup = WorkGroups[WorkGroupIndex];
+	const FGWBWorkUnit& WorkUnit = WorkGroup.WorkUnits[SlotIndex];
+	const FGWBWorkOptions& WorkOptions = WorkUnit.Options;
+
+	// whatever lane entries are left for this unit become stale and get dropped lazily (staged units aren't in any lane yet)
+	if (!WorkUnit.IsStaged())
+	{
+		if (WorkOptions.MaxDelay > 0.f)
+		{
+			WorkGroup.NumWorkUnitsWithMaxDelay--;
+			NumStaleDeadlineWorkUnits++;
+		}
+		else
+		{
+			WorkGroup.NumStaleQueuedWorkUnits++;
+		}
+		if (WorkOptions.MaxNumSkippedFrames > 0)
+		{
+			NumStaleFrameDeadlineWorkUnits++;
+		}
+	}
+	WorkGroup.WorkUnits.RemoveAt(SlotIndex);
+
+	TotalWorkCount--;
+	SET_DWORD_STAT(STAT_GameWorkBalancer_WorkCount, TotalWorkCount);
+}
+
+void UGWBManager::CompactWorkUnitQueues()
+{
+	for (auto ItGroup = WorkGroups.CreateIterator(); ItGroup; ++ItGroup)
+	{
+		FGWBWorkGroup& WorkGroup = *ItGroup;
+		if (ShouldCompact(WorkGroup.NumStaleQueuedWorkUnits, WorkGroup.WorkUnitsQueue.Num()))
+		{
+			WorkGroup.WorkUnitsQueue.RemoveAll([&WorkGroup](const FGWBQueuedWorkUnit& QueuedWorkUnit) { return !WorkGroup.FindWorkUnit(QueuedWorkUnit); });
+			WorkGroup.NumStaleQueuedWorkUnits = 0;
+			UpdateWorkGroupActivity(ItGroup.GetId());
+		}
+	}
+
+	CompactDeadlineWorkUnits(DeadlineWorkUnits, NumStaleDeadlineWorkUnits, [this](const FGWBDeadlineWorkUnit& DeadlineWorkUnit)
+	{
+		const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(DeadlineWorkUnit.GroupIndex);
+		return !WorkGroups.IsValidId(WorkGroupIndex) || !WorkGroups[WorkGroupIndex].FindWorkUnit(DeadlineWorkUnit.SlotIndex, DeadlineWorkUnit.WorkUnitId);
+	});
+	CompactDeadlineWorkUnits(FrameDeadlineWorkUnits, NumStaleFrameDeadlineWorkUnits, [this](const FGWBFrameDeadlineWorkUnit& FrameDeadlineWorkUnit)
+	{
+		const FSetElementId WorkGroupIndex = FSetElementId::FromInteger(FrameDeadlineWorkUnit.GroupIndex);
+		return !WorkGroups.IsValidId(WorkGroupIndex) || !WorkGroups[WorkGroupIndex].FindWorkUnit(FrameDeadlineWorkUnit.SlotIndex, FrameDeadlineWorkUnit.WorkUnitId);
+	});
+}
+
+void UGWBManager::ShrinkIdleWorkGroups()
+{
+	const float ShrinkDelay = CVarGWB_ShrinkDelay.GetValueOnGameThread();
+	if (ShrinkDelay < 0.f) return;
+
+	// a group without any units left has nothing but tombstones in its queue, so its memory can go once it's been idle for a while
+	const double CurrentTime = FGWBClock::Seconds();
+	bool bAllWorkGroupsIdle = true;
+	for (auto ItGroup = WorkGroups.CreateIterator(); ItGroup; ++ItGroup)
+	{
+		FGWBWorkGroup& WorkGroup = *ItGroup;
+		if (WorkGroup.WorkUnits.Num() > 0 || CurrentTime - WorkGroup.LastActiveTimestamp < ShrinkDelay)
+		{
+			bAllWorkGroupsIdle = false;
+			continue;
+		}
+		if (WorkGroup.WorkUnits.GetMaxIndex() == 0 && WorkGroup.WorkUnitsQueue.GetAllocatedSize() == 0) continue;
+
+		UE_LOG(Log_GameplayWorkBalancer, VeryVerbose, TEXT("UGWBManager::ShrinkIdleWorkGroups\t-> Group: %s, Freed: %llu bytes"),
+			*WorkGroup.Def.Id.ToString(),
+			(uint64)(WorkGroup.WorkUnits.GetAllocatedSize() + WorkGroup.WorkUnitsQueue.GetAllocatedSize()));
+		WorkGroup.WorkUnits.Empty(FMath::Max(WorkGroup.Def.NumReservedWorkUnits, 0));
+		WorkGroup.WorkUnitsQueue.Reset();
+		WorkGroup.WorkUnitsQueue.Shrink();
+		WorkGroup.NumStaleQueuedWorkUnits = 0;
+		UpdateWorkGroupActivity(ItGroup.GetId());
+	}
+
+	// same for the lanes once all groups are idle, every entry left in them is stale
+	if (bAllWorkGroupsIdle)
+	{
+		DeadlineWorkUnits.Empty();
+		NumStaleDeadlineWorkUnits = 0;
+		FrameDeadlineWorkUnits.Empty();
+		NumStaleFrameDeadlineWorkUnits = 0;
+		StagedWorkUnits.Empty();
+	}
+}
+
+uint64 UGWBManager::GetFrameCounter() const
+{
+	return GFrameCounter;
+}
+
+void UGWBManager::SetWorkGroupPriority(const FName WorkGroupId, const int32 Priority)
+{
+	FGWBWorkGroup* WorkGroup = WorkGroups.Find(WorkGroupId);
+	if (!ensureAlwaysMsgf(WorkGroup, TEXT("SetWorkGroupPriority -> Invalid WorkGroupId: %s"), *WorkGroupId.ToString())) return;
+	if (WorkGroup->Def.Priority == Priority) return;
+
+	WorkGroup->Def.Priority = Priority;
+	bIsWorkGroupsOrderDirty = true;
+}
+
+void UGWBManager::SetWorkGroupPriorityOffset(FGWBWorkGroup& WorkGroup, const int32 PriorityOffset)
+{
+	if (WorkGroup.PriorityOffset == PriorityOffset) return;
+
+	WorkGroup.PriorityOffset = PriorityOffset;
+	bIsWorkGroupsOrderDirty = true;
+}
+
+void UGWBManager::SetWorkGroupPriorityModifierOffset(FGWBWorkGroup& WorkGroup, const int32 PriorityModifierOffset)
+{
+	if (WorkGroup.PriorityModifierOffset == PriorityModifierOffset) return;
+
+	WorkGroup.PriorityModifierOffset = PriorityModifierOffset;
+	bIsWorkGroupsOrderDirty = true;
+}
+
+void UGWBManager::SortWorkGroups()
+{
+	bIsWorkGroupsOrderDirty = false;
+	WorkGroupsOrder.Reset(WorkGroups.Num());
+	for (auto ItGroup = WorkGroups.CreateConstIterator(); ItGroup; ++ItGroup)
+	{
+		WorkGroupsOrder.Add(ItGroup.GetId());
+	}
+	WorkGroupsOrder.StableSort([this](const FSetElementId A, const FSetElementId B){
+		return WorkGroups[A].GetPriority() < WorkGroups[B].GetPriority();
+	});
+}
+
 
 void UGWBManager::ApplyBudgetModifiers(double& FrameBudget)
 {
 	ModifierManager.ProcessBudgetModifiers(FrameBudget);
 }
 
-void UGWBManager::ApplyGroupBudgetModifiers(FName GroupId, double& TimeBudget, int32& UnitCountBudget)
+void UGWBManager::ApplyGroupBudgetModifiers(FName GroupId, double& TimeBudget)
 {
-	// TODO: extensions could use this
+	ModifierManager.ProcessGroupBudgetModifiers(GroupId, TimeBudget);
 }
 
 void UGWBManager::OnWorkScheduled(FName GroupId)
 {
+	// modifiers only act once budgets are computed, so they hear about scheduled work once per cycle (see `NotifyWorkScheduled`)
+	bHasUnnotifiedScheduledWork = true;
+}
+
+void UGWBManager::NotifyWorkScheduled()
+{
+	if (!bHasUnnotifiedScheduledWork) return;
+	bHasUnnotifiedScheduledWork = false;
+
 	ModifierManager.NotifyWorkScheduled(TotalWorkCount);
+	for (const FGWBWorkGroup& WorkGroup : WorkGroups)
+	{
+		if (ModifierManager.HasGroupBudgetModifiers(WorkGroup.Def.Id))
+		{
+			ModifierManager.NotifyGroupWorkScheduled(WorkGroup.Def.Id, WorkGroup.WorkUnits.Num());
+		}
+	}
 }
 
 void UGWBManager::OnWorkDeferred(uint32 DeferredWorkUnitCount)
@@ -406,12 +893,12 @@ void UGWBManager::OnWorkDeferred(uint32 DeferredWorkUnitCount)
 	ModifierManager.NotifyWorkDeferred(DeferredWorkUnitCount);
 }
 
-void UGWBManager::OnWorkGroupDeferred(FName WorkGroupId)
+void UGWBManager::OnWorkGroupDeferred(FName WorkGroupId, uint32 DeferredWorkUnitCount)
 {
 	// TODO: extensions could use this
 }
 
-void UGWBManager::OnWorkUnitDeferred(FName WorkGroupId)
+void UGWBManager::OnWorkUnitsDeferred(FName WorkGroupId, uint32 DeferredWorkUnitCount)
 {
 	// TODO: extensions could use this
 };
\ No newline at end of file
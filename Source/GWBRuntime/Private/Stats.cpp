@@ -3,7 +3,10 @@
 // Core stats
 DEFINE_STAT(STAT_ScheduleWorkUnit);
 DEFINE_STAT(STAT_DoWorkForFrame);
+DEFINE_STAT(STAT_DoWorkForFrame_SkippedFrames);
+DEFINE_STAT(STAT_DoWorkForFrame_Deadlines);
 DEFINE_STAT(STAT_DoWorkForFrame_Groups);
+DEFINE_STAT(STAT_DoWorkForFrame_Compact);
 DEFINE_STAT(STAT_DoWorkForFrame_Reprioritize);
 DEFINE_STAT(STAT_DoWorkForGroup);
 DEFINE_STAT(STAT_DoWorkForUnit);
@@ -0,0 +1,205 @@
+#include "DataTypes/GWBWorkUnitCallback.h"
+#include "DataTypes/GWBWorkUnitHandle.h"
+#include "Components/GWBTimeSlicer.h"
+#include "GWBRuntimeModule.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "GWBManager.h"
+#include "Tests/RuntimeTestMocks.h"
+#include "Tests/ScopedCvarOverrides.h"
+#include "Utils/GWBLoopUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Measures what the work balancer itself costs: the overhead it adds per unit of work, on top of the work.
+ *
+ * Every result is reported as automation telemetry (so it lands in the automation report) and appended to
+ * `Saved/Automation/GWBBenchmarks.csv` as `Benchmark,NumUnits,Value,Unit` rows, to be diffed against previous runs.
+ * Run with `Automation RunTests GWBRuntime.Benchmarks` (they're in the perf filter, so not part of the product tests).
+ */
+BEGIN_DEFINE_SPEC(FGWBBenchmarks, "GWBRuntime.Benchmarks", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+	UGWBManagerMock* Manager;
+	TArray<FName> WorkGroupIds;
+	int32 NumWorkDone;
+	void ScheduleUnits(int32 NumUnits, bool bBindCallbacks, TArray<FGWBWorkUnitHandle>* OutHandles = nullptr);
+	void RecordResult(const FString& Benchmark, int32 NumUnits, double Value, const TCHAR* Unit);
+	static double GetNanosecondsPerUnit(uint64 Cycles, int32 NumUnits);
+END_DEFINE_SPEC(FGWBBenchmarks)
+
+namespace
+{
+	/** Queue sizes every benchmark of the balancer runs at. */
+	constexpr int32 BenchmarkUnitCounts[] = { 100, 10000, 1000000 };
+	constexpr int32 BenchmarkNumWorkGroups = 4;
+	constexpr int32 BenchmarkNumPriorities = 4;
+}
+
+void FGWBBenchmarks::ScheduleUnits(int32 NumUnits, bool bBindCallbacks, TArray<FGWBWorkUnitHandle>* OutHandles)
+{
+	if (OutHandles) OutHandles->Reserve(NumUnits);
+	for (int32 i = 0; i < NumUnits; i++)
+	{
+		const FGWBWorkUnitHandle Handle = Manager->ScheduleWork(WorkGroupIds[i % WorkGroupIds.Num()], FGWBWorkOptions(i % BenchmarkNumPriorities));
+		if (bBindCallbacks) Handle.OnHandleWork([this]() { NumWorkDone++; });
+		if (OutHandles) OutHandles->Add(Handle);
+	}
+}
+
+void FGWBBenchmarks::RecordResult(const FString& Benchmark, int32 NumUnits, double Value, const TCHAR* Unit)
+{
+	AddTelemetryData(FString::Printf(TEXT("%s.%d"), *Benchmark, NumUnits), Value, Unit);
+	UE_LOG(Log_GameplayWorkBalancer, Display, TEXT("GWBBenchmark\t%s\t%d\t%.3f\t%s"), *Benchmark, NumUnits, Value, Unit);
+
+	const FString ResultsPath = FPaths::Combine(FPaths::AutomationDir(), TEXT("GWBBenchmarks.csv"));
+	if (!IFileManager::Get().FileExists(*ResultsPath))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Benchmark,NumUnits,Value,Unit\n"), *ResultsPath);
+	}
+	FFileHelper::SaveStringToFile(FString::Printf(TEXT("%s,%d,%.3f,%s\n"), *Benchmark, NumUnits, Value, Unit), *ResultsPath,
+		FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+double FGWBBenchmarks::GetNanosecondsPerUnit(uint64 Cycles, int32 NumUnits)
+{
+	return FPlatformTime::ToSeconds64(Cycles) * 1e9 / FMath::Max(NumUnits, 1);
+}
+
+void FGWBBenchmarks::Define()
+{
+	BeforeEach([this]()
+	{
+		Manager = FGWBManagerTestHelper::Create();
+		WorkGroupIds.Reset();
+		for (int32 i = 0; i < BenchmarkNumWorkGroups; i++)
+		{
+			FGWBWorkGroupDefinition WorkGroupDefinition;
+			WorkGroupDefinition.Id = FName(TEXT("BenchmarkGroup"), i);
+			WorkGroupDefinition.Priority = i;
+			Manager->WorkGroups.Add(FGWBWorkGroup(WorkGroupDefinition));
+			WorkGroupIds.Add(WorkGroupDefinition.Id);
+		}
+		NumWorkDone = 0;
+	});
+	AfterEach([this]()
+	{
+		if (Manager->IsValidLowLevel()) Manager->ConditionalBeginDestroy();
+	});
+
+	// times are measured with the platform counter directly, not `FGWBClock`, so they stay real even if a test left a virtual clock installed
+	for (const int32 NumUnits : BenchmarkUnitCounts)
+	{
+		Describe(FString::Printf(TEXT("%d units"), NumUnits), [this, NumUnits]()
+		{
+			It("should measure ScheduleWork overhead per unit", [this, NumUnits]()
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				ScheduleUnits(NumUnits, false);
+				const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+				RecordResult(TEXT("ScheduleWork"), NumUnits, GetNanosecondsPerUnit(Cycles, NumUnits), TEXT("ns/unit"));
+				TestTrue("all units were scheduled", Manager->TEST_GetWorkUnitCount() == uint32(NumUnits));
+			});
+
+			It("should measure DoWork overhead per unit", [this, NumUnits]()
+			{
+				FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+				ScheduleUnits(NumUnits, true);
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				Manager->DoWork();
+				const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+				RecordResult(TEXT("DoWork"), NumUnits, GetNanosecondsPerUnit(Cycles, NumUnits), TEXT("ns/unit"));
+				TestEqual("all units did their work", NumWorkDone, NumUnits);
+			});
+
+			It("should measure AbortWorkUnit overhead per unit", [this, NumUnits]()
+			{
+				TArray<FGWBWorkUnitHandle> Handles;
+				ScheduleUnits(NumUnits, true, &Handles);
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				for (const FGWBWorkUnitHandle& Handle : Handles)
+				{
+					Manager->AbortWorkUnit(Handle);
+				}
+				const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+				RecordResult(TEXT("AbortWorkUnit"), NumUnits, GetNanosecondsPerUnit(Cycles, NumUnits), TEXT("ns/unit"));
+				TestTrue("all units were aborted", Manager->TEST_GetWorkUnitCount() == 0);
+			});
+
+			It("should measure memory per queued unit", [this, NumUnits]()
+			{
+				const FGWBWorkUnitCallbackPool& CallbackPool = FGWBWorkUnitCallbackPool::Get();
+				const SIZE_T SizeBefore = Manager->GetAllocatedSize();
+				const int32 NumRecordsBefore = CallbackPool.GetNumRecordsInUse();
+				ScheduleUnits(NumUnits, true);
+				const SIZE_T Size = Manager->GetAllocatedSize() - SizeBefore
+					+ (CallbackPool.GetNumRecordsInUse() - NumRecordsBefore) * sizeof(FGWBWorkUnitCallbackPool::FRecord);
+				RecordResult(TEXT("MemoryPerQueuedUnit"), NumUnits, double(Size) / NumUnits, TEXT("bytes/unit"));
+				TestTrue("queued units take up memory", Size > 0);
+			});
+
+			It("should measure time sliced loop scope overhead per unit", [this, NumUnits]()
+			{
+				UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Resolve(Manager, UGWBTimeSlicer::GetHandle(Manager, FName("GWBBenchmark")));
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, -1.0, 0);
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				for (int32 i = 0; i < NumUnits; i++)
+				{
+					FGWBTimeSlicedLoopScope TimeSlicedWork = TimeSlicedScope.StartLoopScope();
+					if (TimeSlicedWork.IsOverBudget()) break;
+				}
+				const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+				RecordResult(TEXT("LoopScope"), NumUnits, GetNanosecondsPerUnit(Cycles, NumUnits), TEXT("ns/unit"));
+				TestTrue("every loop scope did a unit of work", TimeSlicedScope.GetWorkUnitsCompleted() == uint32(NumUnits));
+			});
+
+			It("should measure BUDGETED_FOR_LOOP overhead per iteration", [this, NumUnits]()
+			{
+				TArray<int32> Elements;
+				Elements.SetNumZeroed(NumUnits);
+				int64 Sum = 0;
+
+				// the same work without the loop utils, to take the work itself out of the measurement
+				uint64 StartCycles = FPlatformTime::Cycles64();
+				for (int32 i = 0; i < Elements.Num(); i++)
+				{
+					Sum += Elements[i] + i;
+				}
+				const uint64 PlainCycles = FPlatformTime::Cycles64() - StartCycles;
+
+				int32 NumVisited = 0;
+				StartCycles = FPlatformTime::Cycles64();
+				// a budget that can't run out, the loop utils treat a budget <= 0 as no budget at all
+				BUDGETED_FOR_LOOP(Manager, 1000.f, NumUnits, Elements, [&](int32& Element, int32 Index, FBudgetedLoopHandle& Handle) {
+					Sum += Element + Index;
+					NumVisited++;
+				});
+				const uint64 BudgetedCycles = FPlatformTime::Cycles64() - StartCycles;
+
+				const double OverheadCycles = double(BudgetedCycles) - double(PlainCycles);
+				RecordResult(TEXT("BudgetedForLoop"), NumUnits, FMath::Max(OverheadCycles, 0.0) * FPlatformTime::GetSecondsPerCycle64() * 1e9 / NumUnits, TEXT("ns/iteration"));
+				TestEqual("every element was visited", NumVisited, NumUnits);
+				TestTrue("work was not optimized out", Sum >= 0);
+			});
+
+			It("should measure BUDGETED_FOR_LOOP setup overhead per call", [this, NumUnits]()
+			{
+				const TArray<int32> Elements = { 1 };
+				int64 Sum = 0;
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				for (int32 i = 0; i < NumUnits; i++)
+				{
+					BUDGETED_FOR_LOOP(Manager, 1000.f, 1, Elements, [&](const int32& Element, int32 Index, FBudgetedLoopHandle& Handle) {
+						Sum += Element;
+					});
+				}
+				const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+				RecordResult(TEXT("BudgetedForLoopCall"), NumUnits, GetNanosecondsPerUnit(Cycles, NumUnits), TEXT("ns/call"));
+				TestEqual("every call did its element", Sum, int64(NumUnits));
+			});
+		});
+	}
+}
+
+#endif
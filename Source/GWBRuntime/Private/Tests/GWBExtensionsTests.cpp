@@ -10,6 +10,25 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 
+/** Budget modifier for tests that counts how often it runs and overrides the budget it's applied to. */
+class FGWBTestBudgetModifierImpl : public ModifierDefaults<double> {
+public:
+	int32* NumModifyCalls = nullptr;
+	double Budget = 0.0;
+protected:
+	FORCEINLINE void ModifyValueImpl(double& Value) { (*NumModifyCalls)++; Value = Budget; }
+};
+using FGWBTestBudgetModifier = ValueModifierExtension<FGWBTestBudgetModifierImpl, double>;
+
+/** Modifier for tests that counts completed work notifications and scales the budget it's applied to. */
+class FGWBTestCountingModifierImpl : public ModifierDefaults<double> {
+public:
+	int32* NumWorkCompleteCalls = nullptr;
+protected:
+	FORCEINLINE void ModifyValueImpl(double& Value) { Value *= 2.0; }
+	FORCEINLINE void OnWorkCompleteImpl(const uint32& RemainingWorkCount) { (*NumWorkCompleteCalls)++; }
+};
+
 BEGIN_DEFINE_SPEC(FGWBExtensionsTests, "GWBRuntime.Extensions", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
 	// add any member vars here
 	UGWBManagerMock* Manager;
@@ -82,6 +101,119 @@ void FGWBExtensionsTests::Define()
 			TestTrue("frame budget has decayed due to escalation decay", Slicer->GetFrameTimeBudget() < 0.2f);
 		});
 	});
+	Describe("Budget Modifiers", [this]()
+	{
+		PrepareTests();
+		It("should modify the frame budget once per work cycle no matter how many groups work", [this]()
+		{
+			FGWBWorkGroupDefinition OtherDef;
+			OtherDef.Id = FName("OtherGroup");
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherDef));
+			int32 NumModifyCalls = 0;
+			FGWBTestBudgetModifier Modifier;
+			Modifier.NumModifyCalls = &NumModifyCalls;
+			Modifier.Budget = 0.1;
+			Manager->ModifierManager.AddBudgetModifier(MoveTemp(Modifier));
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->ScheduleWork( OtherDef.Id, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestTrue("both groups did their work", Manager->TEST_GetWorkUnitCount() == 0);
+			TestEqual("frame budget was modified once", NumModifyCalls, 1);
+		});
+		It("should only apply group budget modifiers to their own group", [this]()
+		{
+			FGWBWorkGroupDefinition OtherDef;
+			OtherDef.Id = FName("OtherGroup");
+			OtherDef.MaxFrameBudget = 0.1f;
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherDef));
+			int32 NumModifyCalls = 0;
+			FGWBTestBudgetModifier Modifier;
+			Modifier.NumModifyCalls = &NumModifyCalls;
+			Modifier.Budget = 0.05;
+			Manager->ModifierManager.AddGroupBudgetModifier(WorkGroupID, MoveTemp(Modifier));
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->ScheduleWork( OtherDef.Id, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestEqual("group budget was modified once", NumModifyCalls, 1);
+			TestTrue("group works with the modified budget", UGWBTimeSlicer::Get(nullptr, WorkGroupID)->GetFrameTimeBudget() == 0.05);
+			TestTrue("other group works with its own budget", UGWBTimeSlicer::Get(nullptr, OtherDef.Id)->GetFrameTimeBudget() == 0.1f);
+		});
+		It("should know at compile time which hooks a modifier implements", [this]()
+		{
+			TestTrue("budget modifier only modifies values", FGWBTestBudgetModifier::GetHooks() == EModifierHooks::ModifyValue);
+			TestTrue("escalation does not listen to deferred work", !EnumHasAnyFlags(FFrameBudgetEscalationModifier::GetHooks(), EModifierHooks::OnWorkDeferred));
+			using FChain = ModifierChain<double, FGWBTestBudgetModifierImpl, FGWBTestCountingModifierImpl>;
+			TestTrue("chain implements the hooks of all of its modifiers", FChain::GetHooks() == (EModifierHooks::ModifyValue | EModifierHooks::OnWorkComplete));
+		});
+		It("should run a modifier chain in order and notify it once per group", [this]()
+		{
+			FGWBWorkGroupDefinition OtherDef;
+			OtherDef.Id = FName("OtherGroup");
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherDef));
+			int32 NumModifyCalls = 0;
+			int32 NumWorkCompleteCalls = 0;
+			ModifierChain<double, FGWBTestBudgetModifierImpl, FGWBTestCountingModifierImpl> Chain;
+			Chain.Get<0>().NumModifyCalls = &NumModifyCalls;
+			Chain.Get<0>().Budget = 0.05;
+			Chain.Get<1>().NumWorkCompleteCalls = &NumWorkCompleteCalls;
+			Manager->ModifierManager.AddBudgetModifier(MoveTemp(Chain));
+			for (int32 i = 0; i < 5; i++)
+			{
+				Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+				Manager->ScheduleWork( OtherDef.Id, FGWBWorkOptions::EmptyOptions);
+			}
+			Manager->DoWork();
+			TestTrue("all work was done", Manager->TEST_GetWorkUnitCount() == 0);
+			TestEqual("chain modified the budget once", NumModifyCalls, 1);
+			TestTrue("modifiers ran in order", UGWBTimeSlicer::Get(nullptr, FName("GameplayWorkBalancer"))->GetFrameTimeBudget() == 0.1);
+			TestEqual("completed work was notified once per group", NumWorkCompleteCalls, 2);
+		});
+		It("should re-sort work groups when a priority modifier changes their priority", [this]()
+		{
+			FGWBWorkGroupDefinition OtherDef;
+			OtherDef.Id = FName("OtherGroup");
+			OtherDef.Priority = 1;
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherDef));
+			const FSetElementId WorkGroupIndex = Manager->WorkGroups.FindId(WorkGroupID);
+			const FSetElementId OtherWorkGroupIndex = Manager->WorkGroups.FindId(OtherDef.Id);
+			int32 NumModifyCalls = 0;
+			FGWBTestBudgetModifier Modifier;
+			Modifier.NumModifyCalls = &NumModifyCalls;
+			Modifier.Budget = -1.0;
+			Manager->ModifierManager.AddGroupPriorityModifier(OtherDef.Id, MoveTemp(Modifier));
+
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestEqual("group priority was modified once per cycle", NumModifyCalls, 1);
+			TestEqual("modified priority is kept as an offset", Manager->WorkGroups[OtherWorkGroupIndex].GetPriority(), -1);
+			TestTrue("groups were re-sorted", Manager->WorkGroupsOrder == TArray<FSetElementId>({ OtherWorkGroupIndex, WorkGroupIndex }));
+
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestFalse("unchanged modified priority doesn't mark the order dirty", Manager->bIsWorkGroupsOrderDirty);
+		});
+		It("should run priority modifiers for all groups once per cycle", [this]()
+		{
+			FGWBWorkGroupDefinition OtherDef;
+			OtherDef.Id = FName("OtherGroup");
+			OtherDef.Priority = 1;
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherDef));
+			const FSetElementId WorkGroupIndex = Manager->WorkGroups.FindId(WorkGroupID);
+			const FSetElementId OtherWorkGroupIndex = Manager->WorkGroups.FindId(OtherDef.Id);
+			int32 NumModifyCalls = 0;
+			FGWBTestBudgetModifier Modifier;
+			Modifier.NumModifyCalls = &NumModifyCalls;
+			Modifier.Budget = 2.0;
+			Manager->ModifierManager.AddPriorityModifier(MoveTemp(Modifier));
+
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestEqual("priority modifier ran once for both groups", NumModifyCalls, 1);
+			TestEqual("modified offset applies to the group", Manager->WorkGroups[WorkGroupIndex].GetPriority(), 2);
+			TestEqual("modified offset applies to the other group", Manager->WorkGroups[OtherWorkGroupIndex].GetPriority(), 3);
+			TestTrue("groups kept their order", Manager->WorkGroupsOrder == TArray<FSetElementId>({ WorkGroupIndex, OtherWorkGroupIndex }));
+		});
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "GWBManager.h"
 #include "Tests/RuntimeTestMocks.h"
 #include "Tests/ScopedCvarOverrides.h"
+#include "Tests/ScopedVirtualClock.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -114,17 +115,18 @@ void FGWBManagerTests::Define()
 		
 		It("should NOT perform a unit of work after budget is exhausted", [this]()
 		{
+			FScopedVirtualClock Clock;
 			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0.1f);
 			bool bCallbackFired = false;
 			bool bCallback2Fired = false;
-			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallbackFired](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallbackFired, &Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
 			{
-				FPlatformProcess::Sleep(0.1);
+				Clock.AdvanceSeconds(0.1);
 				bCallbackFired = true;
 			});
-			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallback2Fired](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallback2Fired, &Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
 			{
-				FPlatformProcess::Sleep(0.1);
+				Clock.AdvanceSeconds(0.1);
 				bCallback2Fired = true;
 			});
 			Manager->DoWork();
@@ -135,17 +137,18 @@ void FGWBManagerTests::Define()
 		
 		It("should clear work over two iterations if budget exhausted on first iteration", [this]()
 		{
+			FScopedVirtualClock Clock;
 			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0.1f);
 			bool bCallbackFired = false;
 			bool bCallback2Fired = false;
-			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallbackFired](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallbackFired, &Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
 			{
-				FPlatformProcess::Sleep(0.1);
+				Clock.AdvanceSeconds(0.1);
 				bCallbackFired = true;
 			});
-			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallback2Fired](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallback2Fired, &Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
 			{
-				FPlatformProcess::Sleep(0.1);
+				Clock.AdvanceSeconds(0.1);
 				bCallback2Fired = true;
 			});
 			Manager->DoWork();
@@ -160,17 +163,18 @@ void FGWBManagerTests::Define()
 		
 		It("should perform work in order of priority", [this]()
 		{
+			FScopedVirtualClock Clock;
 			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0.1f);
 			bool bCallbackLastFired = false;
-			Manager->ScheduleWork( WorkGroupID, { 1, 0, 0, false, false}).OnHandleWork([&bCallbackLastFired](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
+			Manager->ScheduleWork( WorkGroupID, { 1, 0, 0, false, false}).OnHandleWork([&bCallbackLastFired, &Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
 			{
-				FPlatformProcess::Sleep(0.1);
+				Clock.AdvanceSeconds(0.1);
 				bCallbackLastFired = true;
 			});
 			bool bCallbackFirstFired = false;
-			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallbackFirstFired](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bCallbackFirstFired, &Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
 			{
-				FPlatformProcess::Sleep(0.1);
+				Clock.AdvanceSeconds(0.1);
 				bCallbackFirstFired = true;
 			});
 			Manager->DoWork();
@@ -180,8 +184,297 @@ void FGWBManagerTests::Define()
 			TestTrue("Callback 2 should have fired", bCallbackLastFired);
 			TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0);
 		});
+
+		It("should do exactly as much work per frame as fits in the budget over thousands of frames", [this]()
+		{
+			FScopedVirtualClock Clock;
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0.01f);
+			const int32 FrameCount = 2000;
+			const int32 UnitsPerFrame = 3; // 3 units of 4ms fit in a 10ms budget (the 3rd one starts before it's exhausted)
+			int32 WorkDoneCount = 0;
+			for (int32 i = 0; i < FrameCount * UnitsPerFrame; i++)
+			{
+				Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([&WorkDoneCount, &Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle)
+				{
+					Clock.AdvanceSeconds(0.004);
+					WorkDoneCount++;
+				});
+			}
+			int32 FramesWithUnexpectedWork = 0;
+			for (int32 Frame = 0; Frame < FrameCount; Frame++)
+			{
+				const int32 WorkDoneBefore = WorkDoneCount;
+				Manager->DoWork();
+				if (WorkDoneCount - WorkDoneBefore != UnitsPerFrame) FramesWithUnexpectedWork++;
+				Clock.AdvanceSeconds(1.0 / 60.0);
+			}
+			TestEqual("Every frame should do the same amount of work", FramesWithUnexpectedWork, 0);
+			TestEqual("All work should be done", WorkDoneCount, FrameCount * UnitsPerFrame);
+			TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0);
+		});
+
+		It("should track which groups have queued work as it's scheduled and done", [this]()
+		{
+			FGWBWorkGroupDefinition OtherDef;
+			OtherDef.Id = FName("OtherGroup");
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherDef));
+			const FSetElementId WorkGroupIndex = Manager->WorkGroups.FindId(WorkGroupID);
+			const FSetElementId OtherWorkGroupIndex = Manager->WorkGroups.FindId(OtherDef.Id);
+			TestEqual("no group is active before work is scheduled", Manager->NumActiveWorkGroups, 0);
+
+			Manager->ScheduleWork( OtherDef.Id, FGWBWorkOptions::EmptyOptions);
+			TestTrue("group with work is active", Manager->IsWorkGroupActive(OtherWorkGroupIndex));
+			TestFalse("group without work is not active", Manager->IsWorkGroupActive(WorkGroupIndex));
+			TestEqual("one group is active", Manager->NumActiveWorkGroups, 1);
+
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			Manager->DoWork();
+			TestFalse("group is no longer active once its work is done", Manager->IsWorkGroupActive(OtherWorkGroupIndex));
+			TestEqual("no group is active", Manager->NumActiveWorkGroups, 0);
+		});
+
+		It("should only re-sort groups when a group priority changes", [this]()
+		{
+			FGWBWorkGroupDefinition OtherDef;
+			OtherDef.Id = FName("OtherGroup");
+			OtherDef.Priority = 1;
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherDef));
+			const FSetElementId WorkGroupIndex = Manager->WorkGroups.FindId(WorkGroupID);
+			const FSetElementId OtherWorkGroupIndex = Manager->WorkGroups.FindId(OtherDef.Id);
+
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestTrue("groups are sorted by priority", Manager->WorkGroupsOrder == TArray<FSetElementId>({ WorkGroupIndex, OtherWorkGroupIndex }));
+			TestFalse("order is clean after the cycle", Manager->bIsWorkGroupsOrderDirty);
+
+			Manager->SetWorkGroupPriority(WorkGroupID, 0);
+			TestFalse("setting the same priority keeps the order clean", Manager->bIsWorkGroupsOrderDirty);
+			Manager->SetWorkGroupPriority(WorkGroupID, 2);
+			TestTrue("changing a priority marks the order dirty", Manager->bIsWorkGroupsOrderDirty);
+
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestTrue("groups were re-sorted", Manager->WorkGroupsOrder == TArray<FSetElementId>({ OtherWorkGroupIndex, WorkGroupIndex }));
+			TestFalse("order is clean again", Manager->bIsWorkGroupsOrderDirty);
+		});
 	});
 	
+	Describe("DoWork() - Priority Queue", [this]()
+	{
+		PrepareTests();
+
+		It("should keep FIFO order within the same priority", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			TArray<int32> Order;
+			for (int32 i = 0; i < 5; i++)
+			{
+				Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&Order, i]() { Order.Add(i); });
+			}
+			Manager->DoWork();
+			TestTrue("units ran in the order they were scheduled", Order == TArray<int32>({ 0, 1, 2, 3, 4 }));
+		});
+
+		It("should order units across priorities and keep FIFO within each priority", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			TArray<int32> Order;
+			Manager->ScheduleWork( WorkGroupID, { 2, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(20); });
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(0); });
+			Manager->ScheduleWork( WorkGroupID, { 2, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(21); });
+			Manager->ScheduleWork( WorkGroupID, { 1, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(10); });
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(1); });
+			Manager->DoWork();
+			TestTrue("units ran by priority, then in scheduling order", Order == TArray<int32>({ 0, 1, 10, 20, 21 }));
+		});
+
+		It("should add work to the front of its priority when bAddToFrontOfPriorityQueue is set", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			TArray<int32> Order;
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(1); });
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(2); });
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, true, false}).OnHandleWork([&Order]() { Order.Add(0); });
+			Manager->ScheduleWork( WorkGroupID, { -1, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(-1); });
+			Manager->DoWork();
+			TestTrue("front-queued unit ran first within its priority", Order == TArray<int32>({ -1, 0, 1, 2 }));
+		});
+
+		It("should only move the unit of work whose priority offset changed", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			TArray<int32> Order;
+			TArray<FGWBWorkUnitHandle> Handles;
+			for (int32 i = 0; i < 4; i++)
+			{
+				Handles.Add(Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}));
+				Handles.Last().OnHandleWork([&Order, i]() { Order.Add(i); });
+			}
+			TestTrue("unit was re-prioritized", Manager->SetWorkUnitPriorityOffset(Handles[2], -1));
+			TestTrue("unit was re-prioritized back", Manager->SetWorkUnitPriorityOffset(Handles[1], 1));
+			const FGWBWorkGroup& WorkGroup = *Manager->WorkGroups.Find(WorkGroupID);
+			TestEqual("old entries are left behind as tombstones", WorkGroup.NumStaleQueuedWorkUnits, 2);
+			TestEqual("queue still holds 4 units of work", WorkGroup.GetNumQueuedWorkUnits(), 4);
+			Manager->DoWork();
+			TestTrue("re-prioritized units moved, the others kept their order", Order == TArray<int32>({ 2, 0, 3, 1 }));
+			TestFalse("a unit that's done can't be re-prioritized", Manager->SetWorkUnitPriorityOffset(Handles[0], 1));
+		});
+
+		It("should keep the old entry a tombstone when a unit of work gets its old priority back", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			FScopedCVarOverrideInt CvarCompactThreshold(TEXT("gwb.memory.compactthreshold"), 0);
+			TArray<int32> Order;
+			TArray<FGWBWorkUnitHandle> Handles;
+			for (int32 i = 0; i < 3; i++)
+			{
+				Handles.Add(Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}));
+				Handles.Last().OnHandleWork([&Order, i]() { Order.Add(i); });
+			}
+			TestTrue("unit was re-prioritized", Manager->SetWorkUnitPriorityOffset(Handles[0], -1));
+			TestTrue("unit was re-prioritized back", Manager->SetWorkUnitPriorityOffset(Handles[0], 0));
+			TestTrue("unit was aborted", Manager->AbortWorkUnit(Handles[2]));
+			const FGWBWorkGroup& WorkGroup = *Manager->WorkGroups.Find(WorkGroupID);
+			TestEqual("both old entries of the unit are tombstones", WorkGroup.NumStaleQueuedWorkUnits, 3);
+			Manager->CompactWorkUnitQueues();
+			TestEqual("compaction dropped every tombstone", WorkGroup.WorkUnitsQueue.Num(), 2);
+			TestEqual("no tombstones remain", WorkGroup.NumStaleQueuedWorkUnits, 0);
+			TestEqual("queue still holds 2 units of work", WorkGroup.GetNumQueuedWorkUnits(), 2);
+			Manager->DoWork();
+			TestTrue("unit moved to the back of its old priority and ran once", Order == TArray<int32>({ 1, 0 }));
+			TestEqual("stale count didn't go negative", WorkGroup.NumStaleQueuedWorkUnits, 0);
+		});
+
+		It("should keep order while the queue grows past its initial capacity", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			TArray<int32> Order;
+			TArray<int32> Expected;
+			for (int32 i = 0; i < 100; i++)
+			{
+				// alternate front and back pushes to wrap the ring buffer around
+				const bool bAddToFront = i % 2 == 1;
+				Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, bAddToFront, false}).OnHandleWork([&Order, i]() { Order.Add(i); });
+				if (bAddToFront) Expected.Insert(i, 0); else Expected.Add(i);
+			}
+			Manager->DoWork();
+			TestTrue("all units ran in queue order", Order == Expected);
+		});
+	});
+
+	Describe("DoWork() - Deadlines", [this]()
+	{
+		PrepareTests();
+
+		It("should do work with a MaxDelay in deadline order across groups before regular work", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			FGWBWorkGroupDefinition OtherGroupDefinition;
+			OtherGroupDefinition.Id = FName("OtherGroup");
+			OtherGroupDefinition.Priority = -1;
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherGroupDefinition));
+
+			TArray<FString> Order;
+			Manager->ScheduleWork( OtherGroupDefinition.Id, { 0, 0, 0, false, false}).OnHandleWork([&Order]() { Order.Add(TEXT("regular")); });
+			Manager->ScheduleWork( WorkGroupID, { 0, 3.f, 0, false, false}).OnHandleWork([&Order]() { Order.Add(TEXT("deadline3")); });
+			Manager->ScheduleWork( OtherGroupDefinition.Id, { 0, 1.f, 0, false, false}).OnHandleWork([&Order]() { Order.Add(TEXT("deadline1")); });
+			Manager->ScheduleWork( WorkGroupID, { -10, 2.f, 0, false, false}).OnHandleWork([&Order]() { Order.Add(TEXT("deadline2")); });
+			TestEqual("3 units are tracked as having a max delay", Manager->GetNumWorkUnitsWithMaxDelay(), 3);
+			Manager->DoWork();
+			TestTrue("deadline work ran earliest deadline first, then regular work", Order == TArray<FString>({ TEXT("deadline1"), TEXT("deadline2"), TEXT("deadline3"), TEXT("regular") }));
+			TestEqual("no units with a max delay remain", Manager->GetNumWorkUnitsWithMaxDelay(), 0);
+		});
+
+		It("should force work whose deadline passed even when there's no budget", [this]()
+		{
+			FScopedVirtualClock Clock;
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0);
+			bool bOverdueFired = false;
+			bool bPendingFired = false;
+			Manager->ScheduleWork( WorkGroupID, { 0, 0.001f, 0, false, false}).OnHandleWork([&bOverdueFired]() { bOverdueFired = true; });
+			Manager->ScheduleWork( WorkGroupID, { 0, 10.f, 0, false, false}).OnHandleWork([&bPendingFired]() { bPendingFired = true; });
+			Clock.AdvanceSeconds(0.01f);
+			Manager->DoWork();
+			TestTrue("overdue unit was forced", bOverdueFired);
+			TestFalse("unit within its deadline waits for budget", bPendingFired);
+			TestEqual("1 unit with a max delay remains", Manager->GetNumWorkUnitsWithMaxDelay(), 1);
+		});
+
+		It("should drop aborted deadline work from the deadline lane", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			bool bCallbackFired = false;
+			auto Handle = Manager->ScheduleWork( WorkGroupID, { 0, 1.f, 0, false, false});
+			Handle.OnHandleWork([&bCallbackFired]() { bCallbackFired = true; });
+			Manager->AbortWorkUnit(Handle);
+			TestEqual("aborted unit no longer counts as having a max delay", Manager->GetNumWorkUnitsWithMaxDelay(), 0);
+			Manager->DoWork();
+			TestFalse("aborted unit did not do work", bCallbackFired);
+			TestEqual("stale entry was dropped", Manager->DeadlineWorkUnits.Num(), 0);
+		});
+	});
+
+	Describe("DoWork() - Max Skipped Frames", [this]()
+	{
+		PrepareTests();
+
+		It("should force work that skipped its max number of frames even when there's no budget", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0);
+			int32 NumLimitedFired = 0;
+			bool bUnlimitedFired = false;
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 2, false, false}).OnHandleWork([&NumLimitedFired]() { NumLimitedFired++; });
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false}).OnHandleWork([&bUnlimitedFired]() { bUnlimitedFired = true; });
+			TestEqual("1 unit is tracked as having a max number of skipped frames", Manager->GetNumWorkUnitsWithMaxNumSkippedFrames(), 1);
+			Manager->TEST_FrameCounter = 1;
+			Manager->DoWork();
+			TestEqual("unit skipped its first frame", NumLimitedFired, 0);
+			Manager->TEST_FrameCounter = 2;
+			Manager->DoWork();
+			TestEqual("unit skipped its second frame", NumLimitedFired, 0);
+			Manager->TEST_FrameCounter = 3;
+			Manager->DoWork();
+			TestEqual("unit was forced once it couldn't skip any more frames", NumLimitedFired, 1);
+			TestFalse("unit without a limit keeps waiting for budget", bUnlimitedFired);
+			TestTrue("1 unit remains", Manager->TEST_GetWorkUnitCount() == 1);
+			TestEqual("no units with a max number of skipped frames remain", Manager->GetNumWorkUnitsWithMaxNumSkippedFrames(), 0);
+			Manager->TEST_FrameCounter = 100;
+			Manager->DoWork();
+			TestEqual("forced unit did its work only once", NumLimitedFired, 1);
+		});
+
+		It("should not force work again that was already done within budget", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			int32 NumFired = 0;
+			Manager->ScheduleWork( WorkGroupID, { 0, 0, 1, false, false}).OnHandleWork([&NumFired]() { NumFired++; });
+			Manager->ScheduleWork( WorkGroupID, { 0, 1.f, 1, false, false}).OnHandleWork([&NumFired]() { NumFired++; });
+			Manager->TEST_FrameCounter = 1;
+			Manager->DoWork();
+			TestEqual("both units did their work", NumFired, 2);
+			TestEqual("no units with a max number of skipped frames remain", Manager->GetNumWorkUnitsWithMaxNumSkippedFrames(), 0);
+			Manager->TEST_FrameCounter = 10;
+			Manager->DoWork();
+			TestEqual("units were not forced again", NumFired, 2);
+			TestEqual("stale entries were dropped", Manager->FrameDeadlineWorkUnits.Num(), 0);
+		});
+
+		It("should not force aborted work", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0);
+			bool bCallbackFired = false;
+			auto Handle = Manager->ScheduleWork( WorkGroupID, { 0, 0, 1, false, false});
+			Handle.OnHandleWork([&bCallbackFired]() { bCallbackFired = true; });
+			Manager->AbortWorkUnit(Handle);
+			TestEqual("aborted unit no longer counts as having a max number of skipped frames", Manager->GetNumWorkUnitsWithMaxNumSkippedFrames(), 0);
+			Manager->TEST_FrameCounter = 10;
+			Manager->DoWork();
+			TestFalse("aborted unit did not do work", bCallbackFired);
+			TestEqual("stale entry was dropped", Manager->FrameDeadlineWorkUnits.Num(), 0);
+		});
+	});
+
 	Describe("DoWork() - Group Budget", [this]()
 	{
 		BeforeEach([this]()
@@ -210,15 +503,16 @@ void FGWBManagerTests::Define()
 		
 		It("should stop doing work in a group when the group budget is exhausted", [this]()
 		{
+			FScopedVirtualClock Clock;
 			const FName WorkGroupA = FName("WorkGroupA");
 			const FName WorkGroupB = FName("WorkGroupB");
 			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0.5f);
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.1); });
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.1); });
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.1); });
-			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.1); });
-			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.1); });
-			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.1); });
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([&Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ Clock.AdvanceSeconds(0.1); });
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([&Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ Clock.AdvanceSeconds(0.1); });
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([&Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ Clock.AdvanceSeconds(0.1); });
+			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([&Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ Clock.AdvanceSeconds(0.1); });
+			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([&Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ Clock.AdvanceSeconds(0.1); });
+			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([&Clock](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ Clock.AdvanceSeconds(0.1); });
 			TestTrue("# of scheduled work units is 6", Manager->TEST_GetWorkUnitCount() == 6);
 			Manager->DoWork();
 			TestTrue("# of scheduled work units is 4", Manager->TEST_GetWorkUnitCount() == 4);
@@ -235,15 +529,15 @@ void FGWBManagerTests::Define()
 			const FName WorkGroupA = FName("WorkGroupA");
 			const FName WorkGroupB = FName("WorkGroupB");
 			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0.5f);
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
-			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){ FPlatformProcess::Sleep(0.f); });
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupA, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
+			Manager->ScheduleWork( WorkGroupB, FGWBWorkOptions::EmptyOptions).OnHandleWork([](const float DeltaTime, const FGWBWorkUnitHandle& Handle){});
 			TestTrue("# of scheduled work units is 9", Manager->TEST_GetWorkUnitCount() == 9);
 			Manager->DoWork();
 			TestTrue("# of scheduled work units is 3", Manager->TEST_GetWorkUnitCount() == 3);
@@ -254,6 +548,301 @@ void FGWBManagerTests::Define()
 		});
 	});
 	
+	Describe("DoWork() - Group Skip Policies", [this]()
+	{
+		PrepareTests();
+
+		It("should record a skipped frame for every group with work once over budget", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0);
+			FGWBWorkGroupDefinition OtherGroupDefinition;
+			OtherGroupDefinition.Id = FName("OtherGroup");
+			OtherGroupDefinition.Priority = 1;
+			Manager->WorkGroups.Add(FGWBWorkGroup(OtherGroupDefinition));
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->ScheduleWork( OtherGroupDefinition.Id, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestEqual("first group skipped a frame", Manager->WorkGroups.Find(WorkGroupID)->NumSkippedFrames, 1);
+			TestEqual("second group skipped a frame", Manager->WorkGroups.Find(OtherGroupDefinition.Id)->NumSkippedFrames, 1);
+		});
+
+		It("should only do work for a bSkipUnlessFirstInFrame group when no other work was done first", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			FGWBWorkGroupDefinition ExpensiveGroupDefinition;
+			ExpensiveGroupDefinition.Id = FName("ExpensiveGroup");
+			ExpensiveGroupDefinition.Priority = 1;
+			ExpensiveGroupDefinition.bCanSkipFrame = true;
+			ExpensiveGroupDefinition.bSkipUnlessFirstInFrame = true;
+			Manager->WorkGroups.Add(FGWBWorkGroup(ExpensiveGroupDefinition));
+
+			bool bCheapFired = false;
+			bool bExpensiveFired = false;
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([&bCheapFired]() { bCheapFired = true; });
+			Manager->ScheduleWork( ExpensiveGroupDefinition.Id, FGWBWorkOptions::EmptyOptions).OnHandleWork([&bExpensiveFired]() { bExpensiveFired = true; });
+			Manager->DoWork();
+			TestTrue("cheap group did its work", bCheapFired);
+			TestFalse("expensive group skipped the frame another group already worked in", bExpensiveFired);
+			TestEqual("expensive group skipped a frame", Manager->WorkGroups.Find(ExpensiveGroupDefinition.Id)->NumSkippedFrames, 1);
+			Manager->DoWork();
+			TestTrue("expensive group did its work once it was first in the frame", bExpensiveFired);
+			TestEqual("expensive group's skipped frames were reset", Manager->WorkGroups.Find(ExpensiveGroupDefinition.Id)->NumSkippedFrames, 0);
+		});
+
+		It("should always skip a bAlwaysSkipUntilMax group until it reaches its max skipped frames", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			FGWBWorkGroupDefinition SlowGroupDefinition;
+			SlowGroupDefinition.Id = FName("SlowGroup");
+			SlowGroupDefinition.bCanSkipFrame = true;
+			SlowGroupDefinition.bAlwaysSkipUntilMax = true;
+			SlowGroupDefinition.MaxNumSkippedFrames = 2;
+			Manager->WorkGroups.Add(FGWBWorkGroup(SlowGroupDefinition));
+
+			int32 NumFired = 0;
+			Manager->ScheduleWork( SlowGroupDefinition.Id, FGWBWorkOptions::EmptyOptions).OnHandleWork([&NumFired]() { NumFired++; });
+			Manager->ScheduleWork( SlowGroupDefinition.Id, FGWBWorkOptions::EmptyOptions).OnHandleWork([&NumFired]() { NumFired++; });
+			Manager->DoWork();
+			Manager->DoWork();
+			TestEqual("group skipped 2 frames even though there was budget", NumFired, 0);
+			Manager->DoWork();
+			TestEqual("group did all its work on the 3rd frame", NumFired, 2);
+		});
+
+		It("should force a group that reached its max skipped frames to do work even when over budget", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0);
+			FGWBWorkGroupDefinition LimitedGroupDefinition;
+			LimitedGroupDefinition.Id = FName("LimitedGroup");
+			LimitedGroupDefinition.bCanSkipFrame = true;
+			LimitedGroupDefinition.MaxNumSkippedFrames = 1;
+			Manager->WorkGroups.Add(FGWBWorkGroup(LimitedGroupDefinition));
+
+			int32 NumFired = 0;
+			Manager->ScheduleWork( LimitedGroupDefinition.Id, FGWBWorkOptions::EmptyOptions).OnHandleWork([&NumFired]() { NumFired++; });
+			Manager->ScheduleWork( LimitedGroupDefinition.Id, FGWBWorkOptions::EmptyOptions).OnHandleWork([&NumFired]() { NumFired++; });
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestEqual("group skipped its first frame", NumFired, 0);
+			Manager->DoWork();
+			TestEqual("group was forced to do one unit of work", NumFired, 1);
+			TestEqual("group's skipped frames were reset", Manager->WorkGroups.Find(LimitedGroupDefinition.Id)->NumSkippedFrames, 0);
+			TestEqual("group without a limit keeps skipping", Manager->WorkGroups.Find(WorkGroupID)->NumSkippedFrames, 2);
+		});
+	});
+
+	Describe("DoWork() - Re-entrant Scheduling", [this]()
+	{
+		PrepareTests();
+
+		It("should defer work scheduled from within its own group to the next cycle by default", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			bool bChainedFired = false;
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([this, &bChainedFired]()
+			{
+				Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([&bChainedFired]() { bChainedFired = true; });
+			});
+			Manager->DoWork();
+			TestFalse("chained work did not run in the same cycle", bChainedFired);
+			TestTrue("# of scheduled work units is 1", Manager->TEST_GetWorkUnitCount() == 1);
+			TestEqual("staging inbox was merged after the work loop", Manager->StagedWorkUnits.Num(), 0);
+			Manager->DoWork();
+			TestTrue("chained work ran in the next cycle", bChainedFired);
+			TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0);
+		});
+
+		It("should do chained work in the same cycle when the group is bMutableWhileRunning", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			FScopedCVarOverrideBool CvarImmediate(TEXT("gwb.immediateduringwork"), true);
+			Manager->WorkGroups.Find(WorkGroupID)->Def.bMutableWhileRunning = true;
+			TArray<int32> Order;
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([this, &Order]()
+			{
+				Order.Add(1);
+				Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([this, &Order]()
+				{
+					Order.Add(2);
+					Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([&Order]() { Order.Add(3); });
+				});
+			});
+			Manager->DoWork();
+			TestTrue("whole chain ran in one cycle", Order == TArray<int32>({ 1, 2, 3 }));
+			TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0);
+		});
+
+		It("should defer chained work with bDeferToNextFrame or when gwb.immediateduringwork is off", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			Manager->WorkGroups.Find(WorkGroupID)->Def.bMutableWhileRunning = true;
+			bool bDeferredFired = false;
+			bool bImmediateFired = false;
+			{
+				FScopedCVarOverrideBool CvarImmediate(TEXT("gwb.immediateduringwork"), true);
+				Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([this, &bDeferredFired]()
+				{
+					Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, true}).OnHandleWork([&bDeferredFired]() { bDeferredFired = true; });
+				});
+				Manager->DoWork();
+				TestFalse("work with bDeferToNextFrame did not run in the same cycle", bDeferredFired);
+			}
+			{
+				FScopedCVarOverrideBool CvarImmediate(TEXT("gwb.immediateduringwork"), false);
+				Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([this, &bImmediateFired]()
+				{
+					Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([&bImmediateFired]() { bImmediateFired = true; });
+				});
+				Manager->DoWork();
+				TestTrue("deferred work from the previous cycle ran", bDeferredFired);
+				TestFalse("work did not run in the same cycle with gwb.immediateduringwork off", bImmediateFired);
+			}
+		});
+
+		It("should not do staged work that was aborted before the work loop was done", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			bool bChainedFired = false;
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([this, &bChainedFired]()
+			{
+				auto Handle = Manager->ScheduleWork( WorkGroupID, { 0, 1.f, 1, false, false});
+				Handle.OnHandleWork([&bChainedFired]() { bChainedFired = true; });
+				Manager->AbortWorkUnit(Handle);
+			});
+			Manager->DoWork();
+			TestEqual("staged unit never counted as having a max delay", Manager->GetNumWorkUnitsWithMaxDelay(), 0);
+			TestEqual("staged unit never counted as having a max number of skipped frames", Manager->GetNumWorkUnitsWithMaxNumSkippedFrames(), 0);
+			Manager->DoWork();
+			TestFalse("aborted staged unit did not do work", bChainedFired);
+			TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0);
+		});
+	});
+
+	Describe("DoWork() - Memory", [this]()
+	{
+		PrepareTests();
+
+		It("should compact tombstones out of the queue once they pile up", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0);
+			FScopedCVarOverrideInt CvarCompactThreshold(TEXT("gwb.memory.compactthreshold"), 64);
+			TArray<FGWBWorkUnitHandle> Handles;
+			for (int32 i = 0; i < 100; i++)
+			{
+				Handles.Add(Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions));
+			}
+			for (int32 i = 0; i < 90; i++)
+			{
+				Manager->AbortWorkUnit(Handles[i]);
+			}
+			const FGWBWorkGroup& WorkGroup = *Manager->WorkGroups.Find(WorkGroupID);
+			TestEqual("aborted units left tombstones", WorkGroup.NumStaleQueuedWorkUnits, 90);
+			TestEqual("tombstones don't count as queued work", WorkGroup.GetNumQueuedWorkUnits(), 10);
+			Manager->DoWork();
+			TestEqual("tombstones were compacted at the end of the cycle", WorkGroup.WorkUnitsQueue.Num(), 10);
+			TestEqual("no tombstones remain", WorkGroup.NumStaleQueuedWorkUnits, 0);
+		});
+
+		It("should keep a few tombstones around until the work loop reaches them", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), 0);
+			FScopedCVarOverrideInt CvarCompactThreshold(TEXT("gwb.memory.compactthreshold"), 64);
+			TArray<FGWBWorkUnitHandle> Handles;
+			for (int32 i = 0; i < 10; i++)
+			{
+				Handles.Add(Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions));
+			}
+			for (int32 i = 0; i < 5; i++)
+			{
+				Manager->AbortWorkUnit(Handles[i * 2]);
+			}
+			Manager->DoWork();
+			const FGWBWorkGroup& WorkGroup = *Manager->WorkGroups.Find(WorkGroupID);
+			TestEqual("queue was not compacted", WorkGroup.WorkUnitsQueue.Num(), 10);
+			TestEqual("queue holds 5 units of work", WorkGroup.GetNumQueuedWorkUnits(), 5);
+		});
+
+		It("should release the memory of a group once it has been idle after a burst", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			for (int32 i = 0; i < 1000; i++)
+			{
+				Manager->ScheduleWork( WorkGroupID, { i % 4, 0, 0, false, false});
+			}
+			const FGWBWorkGroup& WorkGroup = *Manager->WorkGroups.Find(WorkGroupID);
+			{
+				FScopedCVarOverrideFloat CvarShrinkDelay(TEXT("gwb.memory.shrinkdelay"), 60.f);
+				Manager->DoWork();
+				TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0);
+				TestTrue("memory is kept while the burst may not be over", WorkGroup.WorkUnitsQueue.GetAllocatedSize() > 0);
+			}
+			{
+				FScopedCVarOverrideFloat CvarShrinkDelay(TEXT("gwb.memory.shrinkdelay"), 0.f);
+				Manager->ShrinkIdleWorkGroups();
+				TestTrue("queue memory was released", WorkGroup.WorkUnitsQueue.GetAllocatedSize() == 0);
+				TestEqual("slot memory was released", WorkGroup.WorkUnits.GetMaxIndex(), 0);
+			}
+			bool bCallbackFired = false;
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([&bCallbackFired]() { bCallbackFired = true; });
+			Manager->DoWork();
+			TestTrue("group still works after shrinking", bCallbackFired);
+		});
+
+		It("should reuse pooled callback records so scheduling doesn't allocate in steady state", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			FGWBWorkUnitCallbackPool& CallbackPool = FGWBWorkUnitCallbackPool::Get();
+			const int32 NumRecordsInUse = CallbackPool.GetNumRecordsInUse();
+			CallbackPool.Reserve(NumRecordsInUse + 100);
+			const int32 Capacity = CallbackPool.GetCapacity();
+			for (int32 Frame = 0; Frame < 3; Frame++)
+			{
+				for (int32 i = 0; i < 100; i++)
+				{
+					Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions).OnHandleWork([]() {});
+				}
+				TestEqual("every unit of work holds a record", CallbackPool.GetNumRecordsInUse(), NumRecordsInUse + 100);
+				Manager->DoWork();
+				TestEqual("records went back to the pool", CallbackPool.GetNumRecordsInUse(), NumRecordsInUse);
+			}
+			TestEqual("pool did not grow", CallbackPool.GetCapacity(), Capacity);
+
+			int32 NumCallbacksFired = 0;
+			{
+				const FGWBWorkUnitHandle Handle = Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+				Manager->DoWork();
+				TestEqual("a handle keeps its record alive after the work is done", CallbackPool.GetNumRecordsInUse(), NumRecordsInUse + 1);
+				Handle.OnHandleWork([&NumCallbacksFired]() { NumCallbacksFired++; });
+			}
+			TestEqual("record was released with the last handle", CallbackPool.GetNumRecordsInUse(), NumRecordsInUse);
+			Manager->ScheduleWork( WorkGroupID, FGWBWorkOptions::EmptyOptions);
+			Manager->DoWork();
+			TestEqual("a reused record starts out unbound", NumCallbacksFired, 0);
+		});
+
+		It("should keep the memory a group reserved when it goes idle", [this]()
+		{
+			FGWBWorkGroupDefinition ReservedDef;
+			ReservedDef.Id = FName("ReservedGroup");
+			ReservedDef.NumReservedWorkUnits = 32;
+			Manager->WorkGroups.Add(FGWBWorkGroup(ReservedDef));
+			const FGWBWorkGroup& WorkGroup = *Manager->WorkGroups.Find(ReservedDef.Id);
+			const SIZE_T ReservedSize = WorkGroup.WorkUnits.GetAllocatedSize();
+			TestTrue("slots were reserved up front", ReservedSize > 0);
+
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			FScopedCVarOverrideFloat CvarShrinkDelay(TEXT("gwb.memory.shrinkdelay"), 0.f);
+			for (int32 i = 0; i < 32; i++)
+			{
+				Manager->ScheduleWork( ReservedDef.Id, FGWBWorkOptions::EmptyOptions);
+			}
+			TestTrue("reserved slots fit the units of work", WorkGroup.WorkUnits.GetAllocatedSize() == ReservedSize);
+			Manager->DoWork();
+			Manager->ShrinkIdleWorkGroups();
+			TestTrue("reserved slots were kept", WorkGroup.WorkUnits.GetAllocatedSize() >= 32 * sizeof(FGWBWorkUnit));
+		});
+	});
+
 	Describe("AbortWorkUnit()", [this]()
 	{
 		PrepareTests();
@@ -265,11 +854,54 @@ void FGWBManagerTests::Define()
 			{
 				bCallbackFired = true;
 			});
-			Manager->AbortWorkUnit(Manager,Handle);
-			TestTrue("# of scheduled work units is 1", Manager->TEST_GetWorkUnitCount() == 1); // note that aborting a unit does NOT de-schedule it
+			TestTrue("Abort should find the scheduled unit", Manager->AbortWorkUnit(Handle));
+			TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0); // aborting frees the unit's slot right away
 			Manager->DoWork();
 			TestTrue("# of scheduled work units is 0", Manager->TEST_GetWorkUnitCount() == 0);
-			TestFalse("Callback should NOT be fired", bCallbackFired == false);
+			TestTrue("the aborted unit's queue entry was dropped", Manager->WorkGroups.Find(WorkGroupID)->WorkUnitsQueue.Num() == 0);
+			TestFalse("Callback should NOT be fired", bCallbackFired);
+		});
+
+		It("should fire the abort callback once and ignore repeated aborts", [this]()
+		{
+			int32 AbortCount = 0;
+			auto Handle = Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false});
+			Handle.GetAbortCallback().BindLambda([&AbortCount]() { AbortCount++; });
+			TestTrue("first abort succeeds", Manager->AbortWorkUnit(Handle));
+			TestFalse("second abort is a no-op", Manager->AbortWorkUnit(Handle));
+			TestEqual("abort callback fired once", AbortCount, 1);
+			TestFalse("unit is no longer pending", Manager->IsWorkUnitPending(Handle));
+		});
+
+		It("should only abort the unit the handle was issued for", [this]()
+		{
+			bool bFirstFired = false;
+			bool bSecondFired = false;
+			auto FirstHandle = Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false});
+			FirstHandle.OnHandleWork([&bFirstFired]() { bFirstFired = true; });
+			Manager->AbortWorkUnit(FirstHandle);
+			// the second unit reuses the slot freed by the first one
+			auto SecondHandle = Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false});
+			SecondHandle.OnHandleWork([&bSecondFired]() { bSecondFired = true; });
+			TestEqual("slot is reused", SecondHandle.GetSlotIndex(), FirstHandle.GetSlotIndex());
+			TestFalse("stale handle does not abort the new unit", Manager->AbortWorkUnit(FirstHandle));
+			TestTrue("new unit is still pending", Manager->IsWorkUnitPending(SecondHandle));
+			Manager->DoWork();
+			TestFalse("aborted unit did not do work", bFirstFired);
+			TestTrue("new unit did work", bSecondFired);
+		});
+
+		It("should not abort a unit that already completed", [this]()
+		{
+			FScopedCVarOverrideFloat CvarFrameBudget(TEXT("gwb.budget.frame"), -1);
+			bool bAbortFired = false;
+			auto Handle = Manager->ScheduleWork( WorkGroupID, { 0, 0, 0, false, false});
+			Handle.GetAbortCallback().BindLambda([&bAbortFired]() { bAbortFired = true; });
+			TestTrue("unit is pending before work", Manager->IsWorkUnitPending(Handle));
+			Manager->DoWork();
+			TestFalse("unit is not pending after work", Manager->IsWorkUnitPending(Handle));
+			TestFalse("abort after completion is a no-op", Manager->AbortWorkUnit(Handle));
+			TestFalse("abort callback should NOT be fired", bAbortFired);
 		});
 	});
 }
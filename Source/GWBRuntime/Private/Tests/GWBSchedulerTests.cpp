@@ -1,6 +1,7 @@
 ﻿#include "Components/GWBScheduler.h"
 #include "Misc/AutomationTest.h"
 #include "Tests/AutomationCommon.h"
+#include "Tests/ScopedCvarOverrides.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -74,4 +75,27 @@ bool FGWBSchedulerStopTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGWBSchedulerIntervalTest, "GWBRuntime.Scheduler.Interval", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FGWBSchedulerIntervalTest::RunTest(const FString& Parameters)
+{
+	UGWBScheduler* Scheduler = FGWBSchedulerTestHelper::CreateScheduler();
+
+	{
+		FScopedCVarOverrideFloat CvarInterval(TEXT("gwb.schedule.interval"), 0.1f);
+		TestTrue("first cycle is due right away", Scheduler->ConsumeWorkCycleInterval(1.0));
+		TestFalse("cycle is not due before the interval passed", Scheduler->ConsumeWorkCycleInterval(1.05));
+		TestTrue("cycle is due once the interval passed", Scheduler->ConsumeWorkCycleInterval(1.12));
+		TestTrue("overshoot of the previous cycle is carried over", Scheduler->ConsumeWorkCycleInterval(1.21));
+		TestFalse("cycle is not due before the next interval passed", Scheduler->ConsumeWorkCycleInterval(1.25));
+		TestTrue("cycle is due after being idle for a while", Scheduler->ConsumeWorkCycleInterval(5.05));
+		TestFalse("missed intervals are not caught up on", Scheduler->ConsumeWorkCycleInterval(5.06));
+	}
+	{
+		FScopedCVarOverrideFloat CvarInterval(TEXT("gwb.schedule.interval"), 0.f);
+		TestTrue("cycle is due every frame without an interval", Scheduler->ConsumeWorkCycleInterval(5.07));
+		TestTrue("cycle is due every frame without an interval", Scheduler->ConsumeWorkCycleInterval(5.08));
+	}
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -4,10 +4,12 @@
 static TAutoConsoleVariable<bool> CVarGWB_Enabled(TEXT("gwb.enabled"), true, TEXT("Whether balancer is enabled."));
 static TAutoConsoleVariable<float> CVarGWB_FrameBudget(TEXT("gwb.budget.frame"), 0.005, TEXT("Time in seconds balancer may spend per frame doing work (negative values mean infnite budget). It is recommended to customize this budget per platform (i.e. slower platforms may need higher budgets to avoid work delays)."));
 static TAutoConsoleVariable<int32> CVarGWB_WorkCountBudget(TEXT("gwb.budget.count"), -1, TEXT("Max number of units of work allowed per work cycle (frame). Negative values mean infinite."));
-static TAutoConsoleVariable<float> CVarGWB_FrameInterval(TEXT("gwb.schedule.interval"), 0.0, TEXT("Time in seconds between balancer work frames, where 0 indicates every frame."));
+static TAutoConsoleVariable<bool> CVarGWB_ImmediateDuringWork(TEXT("gwb.immediateduringwork"), true, TEXT("Whether work scheduled in the currently working category is immediately executed (if the category is bMutableWhileRunning and budget remains) instead of scheduled for next frame."));
+static TAutoConsoleVariable<float> CVarGWB_FrameInterval(TEXT("gwb.schedule.interval"), 0.0, TEXT("Time in seconds between balancer work cycles, where 0 indicates every frame. Time overshooting the interval carries over to the next cycle."));
 
-// not yet implemented
-static TAutoConsoleVariable<bool> CVarGWB_ImmediateDuringWork(TEXT("gwb.immediateduringwork"), true, TEXT("Whether work scheduled in the currently working category is immediately executed instead of scheduled for next frame."));
+// memory
+static TAutoConsoleVariable<float> CVarGWB_ShrinkDelay(TEXT("gwb.memory.shrinkdelay"), 5.0, TEXT("Time in seconds a work group has to be idle (no work scheduled or done) before the memory of its queue and slots is released. Negative values disable shrinking."));
+static TAutoConsoleVariable<int32> CVarGWB_CompactThreshold(TEXT("gwb.memory.compactthreshold"), 64, TEXT("Number of stale entries (of aborted or already done units) a queue may hold before it's compacted at the end of a work cycle, as long as they also make up half of the queue."));
 
 // escalation extension
 static TAutoConsoleVariable<float> CVarGWB_EscalationScalar(TEXT("gwb.escalation.scalar"), 0.5, TEXT("Maximum offset scalar to balancer frame budget when escalation triggered, applied as (budget + budget * scalar)."));
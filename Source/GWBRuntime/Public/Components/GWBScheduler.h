@@ -5,9 +5,14 @@
 
 DECLARE_DELEGATE_OneParam(FGWBOnSchedulerTick, float /* DeltaTime */);
 DECLARE_DELEGATE(FGWBOnSchedulerStartWorkCycle);
+DECLARE_DELEGATE(FGWBOnSchedulerIdle);
 
 /**
  * Manages the scheduling of the work loop. Used by `GWBManager` to schedule itself on tick.
+ *
+ * By default a work cycle starts every frame. When `gwb.schedule.interval` is above 0, cycles start every interval
+ * instead: the time between ticks is accumulated and the part of it that overshot the interval is carried over to the
+ * next cycle, so the cadence doesn't drift with the frame rate.
  */
 UCLASS()
 class GWBRUNTIME_API UGWBScheduler : public UObject
@@ -18,14 +23,29 @@ public:
 	/** Use this delegate to start processing a work batch. */
 	FGWBOnSchedulerStartWorkCycle StartWorkCycleDelegate;
 
+	/** Fires once the scheduler was asked to stay idle for a while, see `StartIdleTimer`. */
+	FGWBOnSchedulerIdle IdleDelegate;
+
 	/** Starts scheduling on tick and firing the schedule delegates. */
 	void Start();
+
+	/** Fires the idle delegate after the provided delay (restarts the delay if already waiting). */
+	void StartIdleTimer(float Delay);
 	
 	/** Stops scheduling and delegates should stop firing. */
 	void Stop();
 
+	/**
+	 * Advances the interval accumulator to the provided timestamp.
+	 * @returns true if a work cycle is due (always the case when `gwb.schedule.interval` is not above 0).
+	 */
+	bool ConsumeWorkCycleInterval(double CurrentTimestamp);
+
 protected:
 	FTimerHandle TickDelegateHandle;
+	FTimerHandle IdleDelegateHandle;
+	double LastTickTimestamp = 0.0;
+	double AccumulatedTime = 0.0;
 	bool ScheduleNextFrame();
 	void TickWork();
 };
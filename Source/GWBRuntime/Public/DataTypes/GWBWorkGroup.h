@@ -1,5 +1,6 @@
 #pragma once
 #include "GWBWorkUnit.h"
+#include "GWBWorkUnitQueue.h"
 
 #include "GWBWorkGroup.generated.h"
 
@@ -19,6 +20,7 @@ struct GWBRUNTIME_API FGWBWorkGroupDefinition
 			, MaxNumSkippedFrames(0)
 			, bAlwaysSkipUntilMax(false)
 			, SkipPriorityDelta(0)
+			, NumReservedWorkUnits(0)
 	{
 	}
 
@@ -30,7 +32,11 @@ struct GWBRUNTIME_API FGWBWorkGroupDefinition
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Default")
 	int32 Priority;
 
-	/** Can new units of work be added and executed while this category is already running. Allows for recursion. */
+	/**
+	 * Can new units of work be added and executed while this category is already running. Allows for recursion.
+	 * When enabled (and `gwb.immediateduringwork` is on) work scheduled from within this category's work is done in the same
+	 * cycle if budget remains, otherwise it is held back and queued once the work loop is done.
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Default")
 	bool bMutableWhileRunning;
 
@@ -46,7 +52,11 @@ struct GWBRUNTIME_API FGWBWorkGroupDefinition
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Default")
 	int32 MaxWorkUnitsPerFrame;
 
-	/** Whether this category is allowed to do no work in a frame, i.e. if higher priority categories use up all available work time. */
+	/**
+	 * Whether this category is allowed to do no work in a frame, i.e. if higher priority categories use up all available work time.
+	 * Enables the skip policies below. A category that can't skip frames still gets deferred when the frame budget is used up,
+	 * it just never skips a frame on purpose.
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Default")
 	bool bCanSkipFrame;
 
@@ -54,7 +64,11 @@ struct GWBRUNTIME_API FGWBWorkGroupDefinition
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Default", meta = (EditCondition = "bCanSkipFrame"))
 	bool bSkipUnlessFirstInFrame;
 
-	/** Maximum number of frames allowed to skip before work for this category must be done (i.e. 0.001 = 1ms). When <= 0, this setting is ignored and work may be deferred. */
+	/**
+	 * Maximum number of frames allowed to skip before work for this category must be done. Once reached, the category does at
+	 * least one unit of work in the next frame even when the frame budget is used up (its own budget still applies).
+	 * When <= 0, this setting is ignored and work may be deferred.
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Default", meta = (EditCondition = "bCanSkipFrame"))
 	int32 MaxNumSkippedFrames;
 
@@ -65,6 +79,16 @@ struct GWBRUNTIME_API FGWBWorkGroupDefinition
 	/** Amount to change priority by when category is skipped in a frame. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Default", meta = (EditCondition = "bCanSkipFrame"))
 	int32 SkipPriorityDelta;
+
+	/// Memory
+
+	/**
+	 * How many units of work of this category are expected to be scheduled at the same time. Slots and pooled callback records
+	 * for that many units are allocated up front (and kept when the category goes idle) so scheduling work doesn't allocate.
+	 * When <= 0, memory is allocated on demand.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Memory")
+	int32 NumReservedWorkUnits;
 };
 
 USTRUCT()
@@ -75,19 +99,26 @@ struct GWBRUNTIME_API FGWBWorkGroup
 	FGWBWorkGroup()
 			: Def()
 			, NumWorkUnitsWithMaxDelay(0)
+			, NumStaleQueuedWorkUnits(0)
 			, PriorityOffset(0)
+			, PriorityModifierOffset(0)
 			, NumSkippedFrames(0)
 			, AverageUnitTime(0.0)
+			, LastActiveTimestamp(0.0)
 	{
 	}
     
 	FGWBWorkGroup(const FGWBWorkGroupDefinition& InDef)
 		: Def(InDef)
 		, NumWorkUnitsWithMaxDelay(0)
+		, NumStaleQueuedWorkUnits(0)
 		, PriorityOffset(0)
+		, PriorityModifierOffset(0)
 		, NumSkippedFrames(0)
 		, AverageUnitTime(0.0)
+		, LastActiveTimestamp(0.0)
 	{
+		WorkUnits.Reserve(FMath::Max(Def.NumReservedWorkUnits, 0));
 	}
 
 	/** Copy of category definition for quick access. */
@@ -95,14 +126,35 @@ struct GWBRUNTIME_API FGWBWorkGroup
 	FGWBWorkGroupDefinition Def;
 
 	/// <runtime_state>
-	UPROPERTY() TArray<FGWBWorkUnit> WorkUnitsQueue; /** Work units in priority order. */
-	UPROPERTY() int32 NumWorkUnitsWithMaxDelay;
+	TSparseArray<FGWBWorkUnit> WorkUnits; /** Slots of the scheduled units of work, indexed by `FGWBWorkUnitHandle::GetSlotIndex()`. */
+	FGWBWorkUnitQueue WorkUnitsQueue; /** Work units bucketed in priority order. */
+	UPROPERTY() int32 NumWorkUnitsWithMaxDelay; /** Units of this group that are queued in the manager's deadline lane instead of `WorkUnitsQueue`. */
+	UPROPERTY() int32 NumStaleQueuedWorkUnits; /** Tombstones: entries of `WorkUnitsQueue` whose unit is gone, compacted out once per work cycle. */
 	UPROPERTY() int32 PriorityOffset;
+	UPROPERTY() int32 PriorityModifierOffset; /** Offset the priority modifiers applied on top of `Def.Priority + PriorityOffset` in the last work cycle. */
 	UPROPERTY() int32 NumSkippedFrames;
 	UPROPERTY() double AverageUnitTime;
+	UPROPERTY() double LastActiveTimestamp; /** When this group last had work scheduled or done, used to release memory once it's idle. */
     /// </runtime_state>
 
-	FORCEINLINE int32 GetPriority() const { return Def.Priority + PriorityOffset; }
+	FORCEINLINE int32 GetPriority() const { return Def.Priority + PriorityOffset + PriorityModifierOffset; }
+
+	/** @returns the number of units waiting in `WorkUnitsQueue`, not counting tombstones. */
+	FORCEINLINE int32 GetNumQueuedWorkUnits() const { return WorkUnitsQueue.Num() - NumStaleQueuedWorkUnits; }
+
+	/** @returns the unit of work in the slot if it is still the one with the provided id and it has not been aborted or completed yet. */
+	FORCEINLINE FGWBWorkUnit* FindWorkUnit(int32 SlotIndex, int32 WorkUnitId)
+	{
+		if (!WorkUnits.IsValidIndex(SlotIndex)) return nullptr;
+		FGWBWorkUnit& WorkUnit = WorkUnits[SlotIndex];
+		return WorkUnit.GetId() == WorkUnitId && WorkUnit.HasWork() ? &WorkUnit : nullptr;
+	}
+	/** @returns the unit of work of the queue entry if it is still pending and the entry is the last one it was queued with. */
+	FORCEINLINE FGWBWorkUnit* FindWorkUnit(const FGWBQueuedWorkUnit& QueuedWorkUnit)
+	{
+		FGWBWorkUnit* WorkUnit = FindWorkUnit(QueuedWorkUnit.SlotIndex, QueuedWorkUnit.WorkUnitId);
+		return WorkUnit && WorkUnit->QueueSerial == QueuedWorkUnit.QueueSerial ? WorkUnit : nullptr;
+	}
 };
 
 struct FGWBWorkGroupSetKeyFuncs : BaseKeyFuncs<FGWBWorkGroup, FName, false>
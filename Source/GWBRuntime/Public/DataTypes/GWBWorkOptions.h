@@ -45,11 +45,17 @@ struct GWBRUNTIME_API FGWBWorkOptions
 	 * NOTES:
 	 * - any value > 0 will cause this work to be prioritized above all work with no maximum delay.
 	 * - lowest remaining delay > 0 is prioritized above pure priority setting.
+	 * - work with a maximum delay is done in deadline order across all groups before any group does its regular work,
+	 *   and once the delay has passed it's done even when the budget is exceeded.
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (UIMin = 0, ClampMin = 0))
 	float MaxDelay;
 
-	/** Maximum number of frames allowed to skip before work must be done. When <=0, this setting is ignored. */
+	/**
+	 * Maximum number of frames allowed to skip before work must be done. When <=0, this setting is ignored.
+	 * NOTE: frames are counted with `GFrameCounter` so this holds regardless of time dilation or frame rate. Once the
+	 * limit is reached the work is done at the start of the next work cycle even when the budget is exceeded.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
 	int32 MaxNumSkippedFrames;
 
@@ -57,7 +63,10 @@ struct GWBRUNTIME_API FGWBWorkOptions
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
 	bool bAddToFrontOfPriorityQueue;
 
-	/** Whether this unit of work should be deferred and may NOT be executed immediately if scheduled while already working on the same work group. */
+	/**
+	 * Whether this unit of work should be deferred and may NOT be executed immediately if scheduled while already working on the same work group.
+	 * Only matters for work scheduled from within the work of its own group while that group is `bMutableWhileRunning`.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
 	bool bDeferToNextFrame;
 };
\ No newline at end of file
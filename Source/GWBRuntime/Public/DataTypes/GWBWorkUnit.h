@@ -1,25 +1,9 @@
 #pragma once
 
 #include "GWBWorkOptions.h"
+#include "GWBWorkUnitCallback.h"
 #include "GWBWorkUnit.generated.h"
 
-struct FGWBWorkUnitHandle;
-
-DECLARE_DELEGATE_TwoParams(FGWBOnDoWorkDelegate, float /*, DeltaTime*/, const FGWBWorkUnitHandle& /*, WorkUnit*/);
-DECLARE_DELEGATE(FGWBAbortWorkDelegate);
-
-USTRUCT()
-struct GWBRUNTIME_API FGWBWorkUnitCallback
-{
-	GENERATED_BODY()
-	
-	/** callback when work should be done with delta time since scheduled. */
-	FGWBOnDoWorkDelegate WorkCallback;
-
-	/** callback when work should be aborted. */
-	FGWBAbortWorkDelegate AbortCallback;
-};
-
 /**
  * @brief The stateful record of a unit of work that needs to be done. As a user you should use `FGWBWorkUnitHandle`.
  * This is intended to be an internal record and not really something for end-users to need to deal with (copying it around etc.)
@@ -33,20 +17,24 @@ struct GWBRUNTIME_API FGWBWorkUnit
 
 	FGWBWorkUnit()
 		: ScheduledTimestamp(0)
+		  , ScheduledFrame(0)
+		  , CallbackHandle(FGWBWorkUnitCallbackRef::Allocate())
+		  , Id(0)
 		  , bHasCompletedWork(false)
 		  , bIsAborted(false)
+		  , bIsStaged(false)
 	{
-		CallbackHandle = MakeShared<FGWBWorkUnitCallback>();
-		Id = FMath::Rand32();
 	}
-	FGWBWorkUnit(const FGWBWorkOptions& InOptions, double InTimeScheduled)
+	FGWBWorkUnit(const FGWBWorkOptions& InOptions, double InTimeScheduled, uint64 InFrameScheduled, int32 InId)
 		: Options(InOptions)
 		, ScheduledTimestamp(InTimeScheduled)
+		, ScheduledFrame(InFrameScheduled)
+		, CallbackHandle(FGWBWorkUnitCallbackRef::Allocate())
+		, Id(InId)
 		, bHasCompletedWork(false)
 		, bIsAborted(false)
+		, bIsStaged(false)
 	{
-		CallbackHandle = MakeShared<FGWBWorkUnitCallback>();
-		Id = FMath::Rand32();
 	}
 
 	/** custom options used to schedule this unit of work. */
@@ -57,14 +45,21 @@ struct GWBRUNTIME_API FGWBWorkUnit
 	UPROPERTY()
 	double ScheduledTimestamp;
 
-	/** callback when work should be done with delta time since scheduled. */
-	TSharedPtr<FGWBWorkUnitCallback> CallbackHandle;
+	/** the frame (`GFrameCounter`) this work was scheduled on. */
+	UPROPERTY()
+	uint64 ScheduledFrame;
+
+	/** callbacks of this unit of work, pooled and shared with its handles. */
+	FGWBWorkUnitCallbackRef CallbackHandle;
 	
 	FORCEINLINE int32 GetId() const { return Id; }
-	FORCEINLINE bool HasWork() const { return !bHasCompletedWork || bIsAborted; }
+	FORCEINLINE bool HasWork() const { return !bHasCompletedWork && !bIsAborted; }
 	FORCEINLINE bool HasCompletedWork() const { return bHasCompletedWork; }
+	FORCEINLINE bool IsAborted() const { return bIsAborted; }
 	FORCEINLINE void MarkCompleted() const { bHasCompletedWork = true; }
 	FORCEINLINE void MarkAborted() const { bIsAborted = true; }
+	FORCEINLINE bool IsStaged() const { return bIsStaged; }
+	FORCEINLINE void SetStaged(bool bInIsStaged) { bIsStaged = bInIsStaged; }
 	
 	// Get effective priority including any runtime adjustments
 	FORCEINLINE int32 GetEffectivePriority() const { return Options.Priority + PriorityOffset; }
@@ -72,11 +67,17 @@ struct GWBRUNTIME_API FGWBWorkUnit
 	FORCEINLINE FGWBOnDoWorkDelegate& GetWorkCallback() const { return CallbackHandle.Get()->WorkCallback; }
 	FORCEINLINE FGWBAbortWorkDelegate& GetAbortCallback() const { return CallbackHandle.Get()->AbortCallback; }
 	
-	// Runtime priority adjustment for this work unit
+	// Runtime priority adjustment for this work unit, change it through `UGWBManager::SetWorkUnitPriorityOffset` so the unit is re-queued
 	int32 PriorityOffset = 0;
 
+	// Bumped whenever the unit is queued again, only its queue entry with the current serial is live
+	int32 QueueSerial = 0;
+
 protected:
+	/** unique (per manager) serial of this unit of work, doubles as the generation of the slot it occupies. */
 	int32 Id;
     mutable bool bHasCompletedWork;
     mutable bool bIsAborted;
+	/** scheduled while its group was working and held back until the work loop is done, not queued in any lane yet. */
+	bool bIsStaged;
 };
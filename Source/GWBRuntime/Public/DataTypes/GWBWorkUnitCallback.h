@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GWBWorkUnitCallback.generated.h"
+
+struct FGWBWorkUnitHandle;
+
+DECLARE_DELEGATE_TwoParams(FGWBOnDoWorkDelegate, float /*, DeltaTime*/, const FGWBWorkUnitHandle& /*, WorkUnit*/);
+DECLARE_DELEGATE(FGWBAbortWorkDelegate);
+
+USTRUCT()
+struct GWBRUNTIME_API FGWBWorkUnitCallback
+{
+	GENERATED_BODY()
+
+	/** callback when work should be done with delta time since scheduled. */
+	FGWBOnDoWorkDelegate WorkCallback;
+
+	/** callback when work should be aborted. */
+	FGWBAbortWorkDelegate AbortCallback;
+};
+
+/**
+ * @brief Slab allocator for the callback records shared between a unit of work and its handles.
+ * Records are handed out from fixed size slabs that are never freed, so their addresses are stable, and returned records
+ * are kept in a free list to be reused by the next unit of work. Once the pool has grown to the number of units of work
+ * that are alive at the same time (or was reserved up front, see `FGWBWorkGroupDefinition::NumReservedWorkUnits`)
+ * scheduling work doesn't allocate anymore.
+ *
+ * Game thread only: reference counts are plain integers and the free list is not synchronized.
+ */
+class GWBRUNTIME_API FGWBWorkUnitCallbackPool
+{
+public:
+
+	struct FRecord
+	{
+		FGWBWorkUnitCallback Callback;
+		int32 RefCount = 0;
+		FRecord* NextFree = nullptr;
+	};
+
+	/** @returns the pool shared by all managers. It's never destroyed so handles outliving their manager stay valid. */
+	static FGWBWorkUnitCallbackPool& Get();
+
+	/** Makes sure at least this many records can be in use at the same time without allocating. */
+	void Reserve(int32 NumRecords);
+
+	/** @returns an unbound record with a reference count of 0. */
+	FRecord* Allocate();
+
+	/** Unbinds the callbacks of the record and puts it back in the free list. */
+	void Release(FRecord* Record);
+
+	FORCEINLINE int32 GetNumRecordsInUse() const { return NumRecordsInUse; }
+	FORCEINLINE int32 GetCapacity() const { return Capacity; }
+
+private:
+
+	void AddSlab(int32 NumRecords);
+
+	TArray<TUniquePtr<FRecord[]>> Slabs;
+	FRecord* FirstFree = nullptr;
+	int32 Capacity = 0;
+	int32 NumRecordsInUse = 0;
+};
+
+/**
+ * Intrusively reference counted pointer to a pooled `FGWBWorkUnitCallback`, the record goes back to the pool once the unit
+ * of work and all of its handles are gone. Stands in for a `TSharedPtr` without the separate allocation and atomics.
+ */
+class FGWBWorkUnitCallbackRef
+{
+public:
+
+	FGWBWorkUnitCallbackRef() = default;
+	FGWBWorkUnitCallbackRef(const FGWBWorkUnitCallbackRef& Other) : Record(Other.Record) { AddRef(); }
+	FGWBWorkUnitCallbackRef(FGWBWorkUnitCallbackRef&& Other) : Record(Other.Record) { Other.Record = nullptr; }
+	~FGWBWorkUnitCallbackRef() { ReleaseRef(); }
+
+	FGWBWorkUnitCallbackRef& operator=(const FGWBWorkUnitCallbackRef& Other)
+	{
+		if (Record != Other.Record)
+		{
+			ReleaseRef();
+			Record = Other.Record;
+			AddRef();
+		}
+		return *this;
+	}
+
+	FGWBWorkUnitCallbackRef& operator=(FGWBWorkUnitCallbackRef&& Other)
+	{
+		if (this != &Other)
+		{
+			ReleaseRef();
+			Record = Other.Record;
+			Other.Record = nullptr;
+		}
+		return *this;
+	}
+
+	/** @returns a reference to a fresh record from the pool. */
+	static FGWBWorkUnitCallbackRef Allocate() { return FGWBWorkUnitCallbackRef(FGWBWorkUnitCallbackPool::Get().Allocate()); }
+
+	FORCEINLINE FGWBWorkUnitCallback* Get() const { return Record ? &Record->Callback : nullptr; }
+	FORCEINLINE FGWBWorkUnitCallback* operator->() const { check(Record); return &Record->Callback; }
+	FORCEINLINE bool IsValid() const { return Record != nullptr; }
+	FORCEINLINE int32 GetRefCount() const { return Record ? Record->RefCount : 0; }
+
+private:
+
+	explicit FGWBWorkUnitCallbackRef(FGWBWorkUnitCallbackPool::FRecord* InRecord) : Record(InRecord) { AddRef(); }
+
+	FORCEINLINE void AddRef()
+	{
+		if (Record) Record->RefCount++;
+	}
+
+	FORCEINLINE void ReleaseRef()
+	{
+		if (Record && --Record->RefCount == 0)
+		{
+			FGWBWorkUnitCallbackPool::Get().Release(Record);
+		}
+		Record = nullptr;
+	}
+
+	FGWBWorkUnitCallbackPool::FRecord* Record = nullptr;
+};
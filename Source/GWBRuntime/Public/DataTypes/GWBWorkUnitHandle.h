@@ -10,6 +10,9 @@
  *
  * The lambda or delegate callback you provide is the actual work that will be done when there is room in the budget
  * managed by the `GWBManager`.
+ *
+ * The handle addresses its unit of work directly (group index + slot index) and carries the unit's id as a generation,
+ * so aborting or looking up the status of a unit is O(1) and a stale handle can never resolve to a different unit.
  */
 USTRUCT(BlueprintType)
 struct GWBRUNTIME_API FGWBWorkUnitHandle
@@ -17,11 +20,14 @@ struct GWBRUNTIME_API FGWBWorkUnitHandle
 	GENERATED_BODY()
 
 	// Default constructor
-	FGWBWorkUnitHandle(): Id(0), bShouldAutoFire(false)
+	FGWBWorkUnitHandle(): Id(0), GroupIndex(INDEX_NONE), SlotIndex(INDEX_NONE), bShouldAutoFire(false)
 	{
 	}
 
-	FGWBWorkUnitHandle(const FGWBWorkUnit& WorkUnit): bShouldAutoFire(false)
+	FGWBWorkUnitHandle(const FGWBWorkUnit& WorkUnit, int32 InGroupIndex, int32 InSlotIndex)
+		: GroupIndex(InGroupIndex)
+		, SlotIndex(InSlotIndex)
+		, bShouldAutoFire(false)
 	{
 		WorkUnitCallbackHandle = WorkUnit.CallbackHandle;
 		Id = WorkUnit.GetId();
@@ -47,15 +53,19 @@ struct GWBRUNTIME_API FGWBWorkUnitHandle
 	static FGWBWorkUnitHandle PassthroughHandle()
 	{
 		FGWBWorkUnitHandle Handle;
-		Handle.WorkUnitCallbackHandle = MakeShared<FGWBWorkUnitCallback>();
+		Handle.WorkUnitCallbackHandle = FGWBWorkUnitCallbackRef::Allocate();
 		Handle.bShouldAutoFire = true;
 		return Handle;
 	}
 	
 	FORCEINLINE int32 GetId() const { return Id; }
+	FORCEINLINE int32 GetGroupIndex() const { return GroupIndex; }
+	FORCEINLINE int32 GetSlotIndex() const { return SlotIndex; }
 	
 protected:
 	int32 Id;
+	int32 GroupIndex;
+	int32 SlotIndex;
 	bool bShouldAutoFire;
-	TSharedPtr<FGWBWorkUnitCallback> WorkUnitCallbackHandle;
+	FGWBWorkUnitCallbackRef WorkUnitCallbackHandle;
 };
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Entry of a work group's priority queue. Points at the slot the unit of work lives in and remembers the id of the unit
+ * it was queued for, so entries whose unit was aborted (and whose slot may have been reused since) can be recognized
+ * and dropped when they are reached. It also remembers the queue serial of the unit, a unit that got re-prioritized
+ * is queued again with a new serial and its old entry is dropped the same way (even if it got its old priority back).
+ */
+struct FGWBQueuedWorkUnit
+{
+	int32 SlotIndex;
+	int32 WorkUnitId;
+	int32 QueueSerial;
+};
+
+/**
+ * Entry of the manager's deadline lanes: the earliest-deadline-first lane for units of work scheduled with a `MaxDelay`
+ * (deadline in `FGWBClock` cycles) and the lane for units scheduled with `MaxNumSkippedFrames` (deadline as a frame number).
+ * Like `FGWBQueuedWorkUnit` it remembers the id of the unit so entries of units that are gone can be recognized as stale.
+ */
+template<typename DeadlineType>
+struct TGWBDeadlineWorkUnit
+{
+	DeadlineType Deadline;
+	int32 GroupIndex;
+	int32 SlotIndex;
+	int32 WorkUnitId;
+
+	FORCEINLINE bool operator<(const TGWBDeadlineWorkUnit& Other) const { return Deadline < Other.Deadline; }
+};
+using FGWBDeadlineWorkUnit = TGWBDeadlineWorkUnit<uint64>;
+using FGWBFrameDeadlineWorkUnit = TGWBDeadlineWorkUnit<uint64>;
+
+/**
+ * Entry of the manager's staging inbox for units of work scheduled re-entrantly (from within the work of their own
+ * group) that may not be done in the same work cycle. They are queued into their lanes once the work loop is done.
+ */
+struct FGWBStagedWorkUnit
+{
+	int32 GroupIndex;
+	int32 SlotIndex;
+	int32 WorkUnitId;
+};
+
+/**
+ * @brief Bucketed priority queue of work units used by each work group.
+ * Entries are kept in one FIFO ring buffer per effective priority and the buckets are kept sorted (lowest priority value
+ * is worked on first). Pushing and popping an entry are O(1) amortized, finding the bucket of a priority that's not
+ * the most recently used one is a binary search over the (usually handful of) distinct priorities in use.
+ *
+ * Drained buckets keep their memory so a group that sees the same priorities every frame doesn't reallocate, `Shrink()`
+ * gives it back once the owner decides a burst is over.
+ */
+struct GWBRUNTIME_API FGWBWorkUnitQueue
+{
+	/** Adds an entry at the back (or front) of the entries with the same priority. */
+	void Push(const FGWBQueuedWorkUnit& Entry, int32 Priority, bool bAddToFront = false);
+
+	/** @returns the entry that should be worked on next. The queue must not be empty. */
+	const FGWBQueuedWorkUnit& Peek() const;
+
+	/** Removes the entry returned by `Peek()`. */
+	void Pop();
+
+	/** Removes all entries (keeps allocated memory). */
+	void Reset();
+
+	/** Releases the memory of drained buckets and trims the ring buffers of the others to fit their entries. */
+	void Shrink();
+
+	/** @returns the number of bytes allocated by the queue. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Removes all entries matching the predicate in one pass, keeping the order of the others. @returns number of removed entries. */
+	template<typename PredicateType>
+	int32 RemoveAll(PredicateType Predicate)
+	{
+		int32 NumRemoved = 0;
+		for (FBucket& Bucket : Buckets)
+		{
+			const int32 Mask = Bucket.Entries.Num() - 1;
+			int32 NumKept = 0;
+			for (int32 i = 0; i < Bucket.Num; i++)
+			{
+				const FGWBQueuedWorkUnit Entry = Bucket.Entries[(Bucket.Head + i) & Mask];
+				if (Predicate(Entry)) continue;
+				Bucket.Entries[(Bucket.Head + NumKept) & Mask] = Entry;
+				NumKept++;
+			}
+			NumRemoved += Bucket.Num - NumKept;
+			Bucket.Num = NumKept;
+			if (NumKept == 0)
+			{
+				Bucket.Head = 0;
+			}
+		}
+		NumEntries -= NumRemoved;
+		UpdateFrontBucketIndex();
+		return NumRemoved;
+	}
+
+	FORCEINLINE int32 Num() const { return NumEntries; }
+	FORCEINLINE bool IsEmpty() const { return NumEntries == 0; }
+
+	/** Calls Func for every entry in the order they would be popped. */
+	template<typename FunctorType>
+	void ForEach(FunctorType Func) const
+	{
+		for (int32 BucketIndex = FrontBucketIndex; BucketIndex < Buckets.Num(); BucketIndex++)
+		{
+			const FBucket& Bucket = Buckets[BucketIndex];
+			for (int32 i = 0; i < Bucket.Num; i++)
+			{
+				Func(Bucket.Entries[(Bucket.Head + i) & (Bucket.Entries.Num() - 1)]);
+			}
+		}
+	}
+
+private:
+
+	/** FIFO ring buffer of the entries sharing one priority. Capacity is always a power of two. */
+	struct FBucket
+	{
+		int32 Priority = 0;
+		int32 Head = 0;
+		int32 Num = 0;
+		TArray<FGWBQueuedWorkUnit> Entries;
+
+		void PushBack(const FGWBQueuedWorkUnit& Entry);
+		void PushFront(const FGWBQueuedWorkUnit& Entry);
+		void Grow();
+		void Resize(int32 NewCapacity);
+	};
+
+	int32 FindOrAddBucket(int32 Priority);
+	void UpdateFrontBucketIndex();
+
+	/** Buckets sorted by priority, buckets before `FrontBucketIndex` are empty. */
+	TArray<FBucket> Buckets;
+	int32 FrontBucketIndex = 0;
+	int32 LastPushedBucketIndex = INDEX_NONE;
+	int32 NumEntries = 0;
+};
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Templates/Function.h"
+#include "Templates/Tuple.h"
+#include "Templates/UniquePtr.h"
+#include <type_traits>
 
 enum EBudgetExceededType
 {
@@ -9,35 +11,109 @@ enum EBudgetExceededType
   UnitCountBudget = 2
 };
 
-// Type-erased value modifier using TFunction
+// Hooks a modifier can implement, known at compile time so callers can skip the ones a modifier doesn't care about
+enum class EModifierHooks : uint8
+{
+  None = 0,
+  ModifyValue = 1 << 0,
+  OnWorkScheduled = 1 << 1,
+  OnWorkComplete = 1 << 2,
+  OnWorkDeferred = 1 << 3,
+  OnBudgetExceeded = 1 << 4,
+  All = ModifyValue | OnWorkScheduled | OnWorkComplete | OnWorkDeferred | OnBudgetExceeded
+};
+ENUM_CLASS_FLAGS(EModifierHooks);
+
+// No-op hooks for modifier implementations to derive from, so they only declare the hooks they need and
+// the hooks they don't declare are compiled out of the modifier chains
 template<typename ValueType>
-class ValueModifier {
+class ModifierDefaults {
+protected:
+  FORCEINLINE void ModifyValueImpl(ValueType& Value) {}
+  FORCEINLINE void OnWorkScheduledImpl(const uint32& TotalWorkCount) {}
+  FORCEINLINE void OnWorkCompleteImpl(const uint32& RemainingWorkCount) {}
+  FORCEINLINE void OnWorkDeferredImpl(const uint32& RemainingWorkCount) {}
+  FORCEINLINE void OnBudgetExceededImpl(EBudgetExceededType Type, const uint32& RemainingWorkCount) {}
+};
+
+// Your original template and implementation classes
+template<typename ImplType, typename ValueType>
+class ValueModifierExtension : public ImplType {
 public:
-  template<typename ImplType>
-  ValueModifier(ImplType&& impl)
+  void ModifyValue(ValueType& Value) { this->ModifyValueImpl(Value); }
+  void OnWorkScheduled(const uint32& TotalWorkCount) { this->OnWorkScheduledImpl(TotalWorkCount); }
+  void OnWorkComplete(const uint32& RemainingWorkCount) { this->OnWorkCompleteImpl(RemainingWorkCount); }
+  void OnWorkDeferred(const uint32& RemainingWorkCount) { this->OnWorkDeferredImpl(RemainingWorkCount); }
+  void OnBudgetExceeded(EBudgetExceededType Type, const uint32& RemainingWorkCount) { this->OnBudgetExceededImpl(Type, RemainingWorkCount); }
+
+  // A hook counts as implemented unless it's the no-op inherited from ModifierDefaults
+  static constexpr EModifierHooks GetHooks()
   {
-    // Create a shared implementation object
-    auto sharedImpl = MakeShared<ImplType>(MoveTemp(impl));
+    using Defaults = ModifierDefaults<ValueType>;
+    EModifierHooks Hooks = EModifierHooks::None;
+    if (!std::is_same_v<decltype(&ValueModifierExtension::ModifyValueImpl), void (Defaults::*)(ValueType&)>) Hooks = Hooks | EModifierHooks::ModifyValue;
+    if (!std::is_same_v<decltype(&ValueModifierExtension::OnWorkScheduledImpl), void (Defaults::*)(const uint32&)>) Hooks = Hooks | EModifierHooks::OnWorkScheduled;
+    if (!std::is_same_v<decltype(&ValueModifierExtension::OnWorkCompleteImpl), void (Defaults::*)(const uint32&)>) Hooks = Hooks | EModifierHooks::OnWorkComplete;
+    if (!std::is_same_v<decltype(&ValueModifierExtension::OnWorkDeferredImpl), void (Defaults::*)(const uint32&)>) Hooks = Hooks | EModifierHooks::OnWorkDeferred;
+    if (!std::is_same_v<decltype(&ValueModifierExtension::OnBudgetExceededImpl), void (Defaults::*)(EBudgetExceededType, const uint32&)>) Hooks = Hooks | EModifierHooks::OnBudgetExceeded;
+    return Hooks;
+  }
+};
 
-    m_ModifyValue = [sharedImpl](ValueType& value) {
-      	sharedImpl->ModifyValue(value);
-    };
+// Statically dispatched chain of modifiers: every hook is a direct (inlinable) call into each modifier that implements
+// it, in the order the modifiers are listed. A chain can be registered as a single modifier with the FModifierManager.
+template<typename ValueType, typename... ImplTypes>
+class ModifierChain {
+public:
+  void ModifyValue(ValueType& Value) {
+    VisitTupleElements([&Value](auto& Modifier) {
+      if constexpr (HasHook<decltype(Modifier)>(EModifierHooks::ModifyValue)) Modifier.ModifyValue(Value);
+    }, m_Modifiers);
+  }
+  void OnWorkScheduled(const uint32& TotalWorkCount) {
+    VisitTupleElements([&TotalWorkCount](auto& Modifier) {
+      if constexpr (HasHook<decltype(Modifier)>(EModifierHooks::OnWorkScheduled)) Modifier.OnWorkScheduled(TotalWorkCount);
+    }, m_Modifiers);
+  }
+  void OnWorkComplete(const uint32& RemainingWorkCount) {
+    VisitTupleElements([&RemainingWorkCount](auto& Modifier) {
+      if constexpr (HasHook<decltype(Modifier)>(EModifierHooks::OnWorkComplete)) Modifier.OnWorkComplete(RemainingWorkCount);
+    }, m_Modifiers);
+  }
+  void OnWorkDeferred(const uint32& RemainingWorkCount) {
+    VisitTupleElements([&RemainingWorkCount](auto& Modifier) {
+      if constexpr (HasHook<decltype(Modifier)>(EModifierHooks::OnWorkDeferred)) Modifier.OnWorkDeferred(RemainingWorkCount);
+    }, m_Modifiers);
+  }
+  void OnBudgetExceeded(EBudgetExceededType Type, const uint32& RemainingWorkCount) {
+    VisitTupleElements([Type, &RemainingWorkCount](auto& Modifier) {
+      if constexpr (HasHook<decltype(Modifier)>(EModifierHooks::OnBudgetExceeded)) Modifier.OnBudgetExceeded(Type, RemainingWorkCount);
+    }, m_Modifiers);
+  }
 
-    m_OnWorkScheduled = [sharedImpl](const uint32& totalWorkCount) {
-      	sharedImpl->OnWorkScheduled(totalWorkCount);
-    };
+  static constexpr EModifierHooks GetHooks() { return (EModifierHooks::None | ... | ValueModifierExtension<ImplTypes, ValueType>::GetHooks()); }
 
-    m_OnWorkComplete = [sharedImpl](const uint32& remainingWorkCount) {
-      	sharedImpl->OnWorkComplete(remainingWorkCount);
-    };
+  // Access to a modifier of the chain, e.g. to configure it before the chain is registered
+  template<uint32 Index>
+  auto& Get() { return m_Modifiers.template Get<Index>(); }
 
-    m_OnWorkDeferred = [sharedImpl](const uint32& remainingWorkCount) {
-      	sharedImpl->OnWorkDeferred(remainingWorkCount);
-    };
+private:
+  template<typename ModifierRefType>
+  static constexpr bool HasHook(EModifierHooks Hook) { return EnumHasAnyFlags(std::decay_t<ModifierRefType>::GetHooks(), Hook); }
 
-    m_OnBudgetExceeded = [sharedImpl](EBudgetExceededType type, const uint32& remainingWorkCount) {
-      	sharedImpl->OnBudgetExceeded(type, remainingWorkCount);
-    };
+  TTuple<ValueModifierExtension<ImplTypes, ValueType>...> m_Modifiers;
+};
+
+// Type-erased value modifier: one virtual call per hook the modifier implements, hooks it doesn't implement are skipped
+// without a call
+template<typename ValueType>
+class ValueModifier {
+public:
+  template<typename ImplType>
+  ValueModifier(ImplType&& impl)
+    : m_Impl(MakeUnique<TModel<std::decay_t<ImplType>>>(MoveTemp(impl)))
+    , m_Hooks(GetHooksOf<std::decay_t<ImplType>>(0))
+  {
   }
 
   // Allow move construction
@@ -50,27 +126,41 @@ public:
   ValueModifier(const ValueModifier&) = delete;
   ValueModifier& operator=(const ValueModifier&) = delete;
 
-  void ModifyValue(ValueType& value) { m_ModifyValue(value); }
-  void OnWorkScheduled(const uint32& totalWorkCount) { m_OnWorkScheduled(totalWorkCount); }
-  void OnWorkComplete(const uint32& remainingWorkCount) { m_OnWorkComplete(remainingWorkCount); }
-  void OnWorkDeferred(const uint32& remainingWorkCount) { m_OnWorkDeferred(remainingWorkCount); }
-  void OnBudgetExceeded(EBudgetExceededType type, const uint32& remainingWorkCount) { m_OnBudgetExceeded(type, remainingWorkCount); }
+  void ModifyValue(ValueType& value) { if (HasHook(EModifierHooks::ModifyValue)) m_Impl->ModifyValue(value); }
+  void OnWorkScheduled(const uint32& totalWorkCount) { if (HasHook(EModifierHooks::OnWorkScheduled)) m_Impl->OnWorkScheduled(totalWorkCount); }
+  void OnWorkComplete(const uint32& remainingWorkCount) { if (HasHook(EModifierHooks::OnWorkComplete)) m_Impl->OnWorkComplete(remainingWorkCount); }
+  void OnWorkDeferred(const uint32& remainingWorkCount) { if (HasHook(EModifierHooks::OnWorkDeferred)) m_Impl->OnWorkDeferred(remainingWorkCount); }
+  void OnBudgetExceeded(EBudgetExceededType type, const uint32& remainingWorkCount) { if (HasHook(EModifierHooks::OnBudgetExceeded)) m_Impl->OnBudgetExceeded(type, remainingWorkCount); }
+
+  FORCEINLINE bool HasHook(EModifierHooks Hook) const { return EnumHasAnyFlags(m_Hooks, Hook); }
 
 private:
-  TFunction<void(ValueType&)> m_ModifyValue;
-  TFunction<void(const uint32&)> m_OnWorkScheduled;
-  TFunction<void(const uint32&)> m_OnWorkComplete;
-  TFunction<void(const uint32&)> m_OnWorkDeferred;
-  TFunction<void(EBudgetExceededType, const uint32&)> m_OnBudgetExceeded;
-};
+  struct IModel {
+    virtual ~IModel() = default;
+    virtual void ModifyValue(ValueType& value) = 0;
+    virtual void OnWorkScheduled(const uint32& totalWorkCount) = 0;
+    virtual void OnWorkComplete(const uint32& remainingWorkCount) = 0;
+    virtual void OnWorkDeferred(const uint32& remainingWorkCount) = 0;
+    virtual void OnBudgetExceeded(EBudgetExceededType type, const uint32& remainingWorkCount) = 0;
+  };
 
-// Your original template and implementation classes
-template<typename ImplType, typename ValueType>
-class ValueModifierExtension : public ImplType {
-public:
-  void ModifyValue(ValueType& Value) { this->ModifyValueImpl(Value); }
-  void OnWorkScheduled(const uint32& TotalWorkCount) { this->OnWorkScheduledImpl(TotalWorkCount); }
-  void OnWorkComplete(const uint32& RemainingWorkCount) { this->OnWorkCompleteImpl(RemainingWorkCount); }
-  void OnWorkDeferred(const uint32& RemainingWorkCount) { this->OnWorkDeferredImpl(RemainingWorkCount); }
-  void OnBudgetExceeded(EBudgetExceededType Type, const uint32& RemainingWorkCount) { this->OnBudgetExceededImpl(Type, RemainingWorkCount); }
-};
\ No newline at end of file
+  template<typename ImplType>
+  struct TModel final : IModel {
+    ImplType m_Impl;
+    explicit TModel(ImplType&& impl) : m_Impl(MoveTemp(impl)) {}
+    virtual void ModifyValue(ValueType& value) override { m_Impl.ModifyValue(value); }
+    virtual void OnWorkScheduled(const uint32& totalWorkCount) override { m_Impl.OnWorkScheduled(totalWorkCount); }
+    virtual void OnWorkComplete(const uint32& remainingWorkCount) override { m_Impl.OnWorkComplete(remainingWorkCount); }
+    virtual void OnWorkDeferred(const uint32& remainingWorkCount) override { m_Impl.OnWorkDeferred(remainingWorkCount); }
+    virtual void OnBudgetExceeded(EBudgetExceededType type, const uint32& remainingWorkCount) override { m_Impl.OnBudgetExceeded(type, remainingWorkCount); }
+  };
+
+  // modifiers that can't tell which hooks they implement get all of them called
+  template<typename ImplType>
+  static constexpr auto GetHooksOf(int) -> decltype(ImplType::GetHooks()) { return ImplType::GetHooks(); }
+  template<typename ImplType>
+  static constexpr EModifierHooks GetHooksOf(...) { return EModifierHooks::All; }
+
+  TUniquePtr<IModel> m_Impl;
+  EModifierHooks m_Hooks;
+};
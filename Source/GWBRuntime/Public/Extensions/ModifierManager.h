@@ -12,9 +12,12 @@ class UGWBManager;
  * Then, once budgets are calculated, this manager is meant to be invoked via `ProcessBudgetModifiers()` (and similar)
  * to modify the final values based on additional (optional) rules that can be defined by your own project.
  *
+ * Modifiers are notified in batches (scheduled work once per cycle, completed work once per group or lane) and only
+ * through the hooks they implement. Several modifiers can be registered as one `ModifierChain` to dispatch to all of
+ * them statically.
+ *
  * (author's note: this whole system is a bit underbaked, but at least in principle it's fast since it doesn't
- * use inheritance or virtual method tables but relies on type erasure instead... this means it's never going to be
- * BP compatible.)
+ * use inheritance for the modifiers themselves... this means it's never going to be BP compatible.)
  */
 class FModifierManager {
   friend UGWBManager;
@@ -35,17 +38,44 @@ public:
   void Reset()
   {
       m_BudgetModifiers.Empty();
+      m_GroupBudgetModifiers.Empty();
       m_PriorityModifiers.Empty();
+      m_GroupPriorityModifiers.Empty();
   }
 
   void AddBudgetModifier(ValueModifier<double> modifier) {
       m_BudgetModifiers.Add(MoveTemp(modifier));
   }
 
+  /**
+   * Adds a modifier for the time budget of a single work group. Each group gets its own chain (and its own modifier
+   * state) which is notified with the work count of that group only, so e.g. an escalation modifier follows the
+   * backlog of its group.
+   */
+  void AddGroupBudgetModifier(FName GroupId, ValueModifier<double> modifier) {
+      m_GroupBudgetModifiers.FindOrAdd(GroupId).Add(MoveTemp(modifier));
+  }
+
+  bool HasGroupBudgetModifiers(FName GroupId) const {
+      return m_GroupBudgetModifiers.Contains(GroupId);
+  }
+
+  // Priority modifiers adjust the priority of every work group once per work cycle, work groups are only re-sorted
+  // when a modified priority actually changed. They run once per cycle on an offset (starting at 0) that is added to
+  // the priority of every group.
   void AddPriorityModifier(ValueModifier<double> modifier) {
       m_PriorityModifiers.Add(MoveTemp(modifier));
   }
 
+  // Adds a priority modifier that only applies to a single work group (after the ones for all groups)
+  void AddGroupPriorityModifier(FName GroupId, ValueModifier<double> modifier) {
+      m_GroupPriorityModifiers.FindOrAdd(GroupId).Add(MoveTemp(modifier));
+  }
+
+  bool HasPriorityModifiers() const {
+      return m_PriorityModifiers.Num() > 0 || m_GroupPriorityModifiers.Num() > 0;
+  }
+
 protected:
 
   void ProcessBudgetModifiers(double& value) {
@@ -54,12 +84,28 @@ protected:
       }
   }
 
+  void ProcessGroupBudgetModifiers(FName GroupId, double& value) {
+      if (auto* modifiers = m_GroupBudgetModifiers.Find(GroupId)) {
+          for (auto& modifier : *modifiers) {
+              modifier.ModifyValue(value);
+          }
+      }
+  }
+
   void ProcessPriorityModifiers(double& value) {
       for (auto& modifier : m_PriorityModifiers) {
           modifier.ModifyValue(value);
       }
   }
 
+  void ProcessGroupPriorityModifiers(FName GroupId, double& value) {
+      if (auto* modifiers = m_GroupPriorityModifiers.Find(GroupId)) {
+          for (auto& modifier : *modifiers) {
+              modifier.ModifyValue(value);
+          }
+      }
+  }
+
   void NotifyWorkScheduled(const uint32& TotalWorkCount) {
       for (auto& modifier : m_BudgetModifiers) {
           modifier.OnWorkScheduled(TotalWorkCount);
@@ -87,6 +133,22 @@ protected:
       }
   }
 
+  void NotifyGroupWorkScheduled(FName GroupId, const uint32& GroupWorkCount) {
+      if (auto* modifiers = m_GroupBudgetModifiers.Find(GroupId)) {
+          for (auto& modifier : *modifiers) {
+              modifier.OnWorkScheduled(GroupWorkCount);
+          }
+      }
+  }
+
+  void NotifyGroupWorkComplete(FName GroupId, const uint32& RemainingGroupWorkCount) {
+      if (auto* modifiers = m_GroupBudgetModifiers.Find(GroupId)) {
+          for (auto& modifier : *modifiers) {
+              modifier.OnWorkComplete(RemainingGroupWorkCount);
+          }
+      }
+  }
+
   void NotifyBudgetExceeded(EBudgetExceededType Type, const uint32& RemainingWorkCount) {
       for (auto& modifier : m_BudgetModifiers) {
           modifier.OnBudgetExceeded(Type, RemainingWorkCount);
@@ -98,5 +160,7 @@ protected:
 
 private:
   TArray<ValueModifier<double>> m_BudgetModifiers;
+  TMap<FName, TArray<ValueModifier<double>>> m_GroupBudgetModifiers;
   TArray<ValueModifier<double>> m_PriorityModifiers;
+  TMap<FName, TArray<ValueModifier<double>>> m_GroupPriorityModifiers;
 };
\ No newline at end of file
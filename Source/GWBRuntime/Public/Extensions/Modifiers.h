@@ -5,7 +5,7 @@
 /**
  * @brief Modifies the work budget by escalating it each time that there is too much work in a single frame.
  */
-class FFrameBudgetEscalationModifierImpl {
+class FFrameBudgetEscalationModifierImpl : public ModifierDefaults<double> {
 private:
 	double EscalationScalar = 0;
 	double LastEscalationUpdateTimestamp = 0;
@@ -14,9 +14,7 @@ protected:
 	void ModifyValueImpl(double& Value);
 	void OnWorkScheduledImpl(const uint32& TotalWorkCount);
 	void OnWorkCompleteImpl(const uint32& RemainingWorkCount);
-	FORCEINLINE void OnWorkDeferredImpl(const uint32& RemainingWorkCount) {}
-	FORCEINLINE void OnBudgetExceededImpl(EBudgetExceededType Type, const uint32& RemainingWorkCount) {}
 };
 
-// type erasure based implementation
+// register it with the FModifierManager, or list FFrameBudgetEscalationModifierImpl in a ModifierChain
 using FFrameBudgetEscalationModifier = ValueModifierExtension<FFrameBudgetEscalationModifierImpl, double>;
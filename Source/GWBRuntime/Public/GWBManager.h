@@ -10,13 +10,26 @@
 #include "DataTypes/GWBWorkUnit.h"
 #include "DataTypes/GWBWorkOptions.h"
 #include "DataTypes/GWBWorkUnitHandle.h"
+#include "DataTypes/GWBTimeSlicerHandle.h"
 #include "Extensions/ModifierManager.h"
 
 #include "GWBManager.generated.h"
 
+class UGWBTimeSlicer;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGWBOnBeforeDoWorkDelegate, float, TimeSinceScheduled);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FGWBBlueprintWorkDelegate, float, TimeSinceScheduled, const FGWBWorkUnitHandle&, Handle);
 
+/**
+ * Budgets of a work cycle, read from the CVars and run through the budget modifiers once when the cycle starts so every
+ * lane and group of the cycle works against the same numbers.
+ */
+struct FGWBWorkCycleBudget
+{
+	double FrameBudget = -1.0;
+	int32 WorkCountBudget = -1;
+};
+
 /**
  * Manages the work loop, tracks budgets, and fires off the work delegates when work needs to be done.
  *
@@ -56,13 +69,26 @@ public:
 	static FGWBWorkUnitHandle ScheduleWork(const UObject* WorldContextObject, UPARAM(meta = (GetOptions = "GetValidGroupNames")) FName WorkGroupId = "Default", UPARAM(ref) const FGWBWorkOptions& WorkOptions = FGWBWorkOptions());
 	
 	/**
-	 * Aborting a work unit is, unfortunately, expensive as it uses a handle indexed by Id and loops through
-	 * all the groups and their work units to find the one to abort.
-	 * ...Should be improved in the future.
+	 * Aborts a scheduled unit of work: its abort callback fires and its work callback never will.
+	 * The handle addresses the unit's slot directly so this is O(1). Aborting a unit that already completed or was
+	 * already aborted does nothing.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "GameWorkBalancer", meta=(GameplayTagFilter="GameWork", WorldContext="WorldContextObject"))
 	static void AbortWorkUnit(const UObject* WorldContextObject, FGWBWorkUnitHandle WorkUnitHandle);
 
+	/** @returns true if the unit of work is still waiting for its work callback to fire (i.e. not completed and not aborted). */
+	UFUNCTION(BlueprintPure, Category = "GameWorkBalancer", meta=(WorldContext="WorldContextObject"))
+	static bool IsWorkUnitPending(const UObject* WorldContextObject, const FGWBWorkUnitHandle& WorkUnitHandle);
+
+	/** Changes the base priority (low to high) of a work group at runtime, the groups are re-sorted before the next work cycle. */
+	void SetWorkGroupPriority(FName WorkGroupId, int32 Priority);
+
+	/**
+	 * Changes the priority offset of a scheduled unit of work. A queued unit is moved to the back of the units of its new
+	 * priority, no other unit moves. @returns false if the unit is no longer pending.
+	 */
+	bool SetWorkUnitPriorityOffset(const FGWBWorkUnitHandle& WorkUnitHandle, int32 PriorityOffset);
+
 	/** Bind a Blueprint callback to a work handle. */
 	UFUNCTION(BlueprintCallable, Category = "GameWorkBalancer")
 	static void BindBlueprintCallback(UPARAM(ref) FGWBWorkUnitHandle& Handle, const FGWBBlueprintWorkDelegate& OnDoWork);
@@ -87,9 +113,25 @@ protected:
 	/// 
 	void				Reset();
 	FGWBWorkUnitHandle	ScheduleWork(const FName& WorkGroupId, const FGWBWorkOptions& WorkOptions);
+	bool				ShouldStageWorkUnit(FSetElementId WorkGroupIndex, const FGWBWorkOptions& WorkOptions) const;
+	void				EnqueueWorkUnit(FSetElementId WorkGroupIndex, int32 SlotIndex);
+	void				MergeStagedWorkUnits();
+	void				UpdateWorkGroupActivity(FSetElementId WorkGroupIndex);
+	bool				AbortWorkUnit(const FGWBWorkUnitHandle& WorkUnitHandle);
+	bool				IsWorkUnitPending(const FGWBWorkUnitHandle& WorkUnitHandle) const;
 	void				DoWork();
-	void				DoWorkForGroup(FGWBWorkGroup& WorkGroup);
-	void				DoWorkForUnit(const FGWBWorkUnit& WorkUnit) const;
+	FGWBWorkCycleBudget	MakeWorkCycleBudget();
+	void				DoWorkForSkippedFrames(const FGWBWorkCycleBudget& Budget);
+	void				DoWorkForDeadlines(const FGWBWorkCycleBudget& Budget);
+	int32				DoWorkForGroup(FSetElementId WorkGroupIndex, const FGWBWorkCycleBudget& Budget, bool bMustDoWork = false);
+	void				DoWorkForUnit(const FGWBWorkUnit& WorkUnit, const FGWBWorkUnitHandle& WorkUnitHandle, uint64 StartWorkCycles);
+	void				RetireWorkUnit(FSetElementId WorkGroupIndex, int32 SlotIndex);
+	void				CompactWorkUnitQueues();
+	void				ShrinkIdleWorkGroups();
+	void				SetWorkGroupPriorityOffset(FGWBWorkGroup& WorkGroup, int32 PriorityOffset);
+	void				SetWorkGroupPriorityModifierOffset(FGWBWorkGroup& WorkGroup, int32 PriorityModifierOffset);
+	void				SortWorkGroups();
+	virtual uint64		GetFrameCounter() const;
 	///
 	/// </core-api>
 	///
@@ -98,11 +140,12 @@ protected:
 	/// <extension-points>
 	///
 	void				ApplyBudgetModifiers(double& FrameBudget);
-	void				ApplyGroupBudgetModifiers(FName GroupId, double& TimeBudget, int32& UnitCountBudget);
+	void				ApplyGroupBudgetModifiers(FName GroupId, double& TimeBudget);
 	void				OnWorkScheduled(FName GroupId);
+	void				NotifyWorkScheduled();
 	void				OnWorkDeferred(uint32 DeferredWorkUnitCount);
-	void				OnWorkGroupDeferred(FName WorkGroupId);
-	void				OnWorkUnitDeferred(FName WorkGroupId);
+	void				OnWorkGroupDeferred(FName WorkGroupId, uint32 DeferredWorkUnitCount);
+	void				OnWorkUnitsDeferred(FName WorkGroupId, uint32 DeferredWorkUnitCount);
 	///
 	/// </extension-points>
 	///
@@ -115,7 +158,19 @@ public:
 	bool				bIsDoingWork;
 	uint32				TotalWorkCount;
 	TSet<FGWBWorkGroup, FGWBWorkGroupSetKeyFuncs> WorkGroups;
+	TArray<FSetElementId> WorkGroupsOrder; /** Indices into `WorkGroups` in execution order. Groups themselves never move so handles can index them. */
+	bool				bIsWorkGroupsOrderDirty; /** Set when the priority of a group changed since `WorkGroupsOrder` was sorted. */
+	TBitArray<>			ActiveWorkGroups; /** Bit per index of `WorkGroups`, set while the group has entries in its queue. */
+	int32				NumActiveWorkGroups; /** Number of bits set in `ActiveWorkGroups`. */
+	TArray<FGWBDeadlineWorkUnit> DeadlineWorkUnits; /** Min-heap (earliest deadline first) of all units of work scheduled with a `MaxDelay`. */
+	int32				NumStaleDeadlineWorkUnits; /** Entries of `DeadlineWorkUnits` whose unit is gone, dropped lazily. */
+	TArray<FGWBFrameDeadlineWorkUnit> FrameDeadlineWorkUnits; /** Min-heap (earliest frame first) of all units of work scheduled with a `MaxNumSkippedFrames`. */
+	int32				NumStaleFrameDeadlineWorkUnits; /** Entries of `FrameDeadlineWorkUnits` whose unit is gone, dropped lazily. */
+	int32				NextWorkUnitId;
+	FSetElementId		WorkingGroupIndex; /** Group of the unit of work whose callback is running, invalid outside of callbacks. */
+	TArray<FGWBStagedWorkUnit> StagedWorkUnits; /** Units scheduled re-entrantly that have to wait for the next work cycle. */
 	bool				bPendingReset;
+	bool				bHasUnnotifiedScheduledWork; /** Work was scheduled since the modifiers were last notified, they are notified once per cycle. */
 	///
 	/// </state>
 	///
@@ -123,8 +178,27 @@ public:
 
 	TArray<FName> GetValidGroupNames() const;
 
+	/** @returns how many scheduled units of work (across all groups) have a `MaxDelay` deadline. */
+	FORCEINLINE int32 GetNumWorkUnitsWithMaxDelay() const { return DeadlineWorkUnits.Num() - NumStaleDeadlineWorkUnits; }
+
+	/** @returns how many scheduled units of work (across all groups) have a `MaxNumSkippedFrames` limit. */
+	FORCEINLINE int32 GetNumWorkUnitsWithMaxNumSkippedFrames() const { return FrameDeadlineWorkUnits.Num() - NumStaleFrameDeadlineWorkUnits; }
+
+	/** @returns the bytes allocated by the groups and lanes of the manager. Callback records live in the shared `FGWBWorkUnitCallbackPool` and aren't counted. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** @returns true if the group has entries in its queue (tombstones included) the work loop has to visit it for. */
+	FORCEINLINE bool IsWorkGroupActive(FSetElementId WorkGroupIndex) const
+	{
+		const int32 Index = WorkGroupIndex.AsInteger();
+		return Index < ActiveWorkGroups.Num() && ActiveWorkGroups[Index];
+	}
+
 protected:
 	
 	TWeakObjectPtr<UGWBScheduler> Scheduler;
+	UPROPERTY()
+	UGWBTimeSlicer* WorkBalancerTimeSlicer; // global budget of the work balancer, resolved once per cycle so the work loops don't look it up per unit
+	FGWBTimeSlicerHandle WorkBalancerTimeSlicerHandle; // resolves `WorkBalancerTimeSlicer` without a lookup by name unless the slicer was evicted
 	FModifierManager ModifierManager; // Extension framework
 };
@@ -6,7 +6,10 @@ DECLARE_STATS_GROUP(TEXT("GameWorkBalancer"), STATGROUP_GameWorkBalancer, STATCA
 
 DECLARE_CYCLE_STAT_EXTERN(TEXT("ScheduleWorkUnit"), STAT_ScheduleWorkUnit, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForFrame"), STAT_DoWorkForFrame, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForFrame_SkippedFrames"), STAT_DoWorkForFrame_SkippedFrames, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForFrame_Deadlines"), STAT_DoWorkForFrame_Deadlines, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForFrame_Groups"), STAT_DoWorkForFrame_Groups, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForFrame_Compact"), STAT_DoWorkForFrame_Compact, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForFrame_Reprioritize"), STAT_DoWorkForFrame_Reprioritize, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForGroup"), STAT_DoWorkForGroup, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("DoWorkForUnit"), STAT_DoWorkForUnit, STATGROUP_GameWorkBalancer, GWBRUNTIME_API);
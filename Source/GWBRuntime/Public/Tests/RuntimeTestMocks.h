@@ -26,12 +26,9 @@ public:
 	uint32 TEST_GetWorkUnitCount()
 	{
 		int32 Count = 0;
-		for (auto G : WorkGroups)
+		for (const auto& G : WorkGroups)
 		{
-			for (auto U : G.WorkUnitsQueue)
-			{
-				Count++;
-			}
+			Count += G.WorkUnits.Num();
 		}
 		return Count;
 	};
@@ -39,6 +36,10 @@ public:
 	{
 		Scheduler = NewObject<UGWBScheduler>();
 	};
+
+	/** frame number the manager sees, tests advance it by hand since the engine doesn't tick frames while they run */
+	uint64 TEST_FrameCounter = 0;
+	virtual uint64 GetFrameCounter() const override { return TEST_FrameCounter; }
 };
 
 /**
@@ -4,69 +4,89 @@
 #include "Components/GWBTimeSlicer.h"
 
 #include "GWBTimeSlicersSubsystem.h"
+#include "DataTypes/GWBTimeSlicerRegistry.h"
 #include "GWBTimeSlicerModule.h"
 
 UGWBTimeSlicer::UGWBTimeSlicer()
 {
-	LastResetTimestamp = FPlatformTime::Seconds();
+	LastResetCycles = FGWBClock::Cycles();
+	UpdateFrameBudgetExceededCycles();
 }
 
-void UGWBTimeSlicer::Init()
+void UGWBTimeSlicer::Init(FName InId)
 {
-	UnitWorkDurations = TCircularBuffer<double>(5);
+	Id = InId;
+	LastUsedFrame = GFrameCounter;
 }
 
 UGWBTimeSlicer* UGWBTimeSlicer::Get(const UObject* WorldContextObject, FName Id)
 {
-	UGWBTimeSlicersSubsystem* Subsystem = GEngine->GetEngineSubsystem<UGWBTimeSlicersSubsystem>();
-	return Subsystem->GetTimeSlicer(Id);
+	return UGWBTimeSlicersSubsystem::GetTimeSlicer(WorldContextObject, UGWBTimeSlicersSubsystem::GetTimeSlicerHandle(WorldContextObject, Id));
+}
+
+FGWBTimeSlicerHandle UGWBTimeSlicer::GetHandle(const UObject* WorldContextObject, FName Id)
+{
+	return UGWBTimeSlicersSubsystem::GetTimeSlicerHandle(WorldContextObject, Id);
+}
+
+UGWBTimeSlicer* UGWBTimeSlicer::Resolve(const UObject* WorldContextObject, FGWBTimeSlicerHandle Handle)
+{
+	UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicersSubsystem::GetTimeSlicer(WorldContextObject, Handle);
+	if (!TimeSlicer && Handle.IsValid())
+	{
+		// the slicer was evicted for being idle, fall back to looking it up (i.e. creating it again) by name
+		TimeSlicer = Get(WorldContextObject, Handle.GetId());
+	}
+	return TimeSlicer;
 }
 
 void UGWBTimeSlicer::Reset()
 {
+	// scopes reset the slicer when they start and when they end, only the resets closing a cycle with work done count
+	if (CycleWorkUnitsCompleted > 0)
+	{
+		Telemetry.RecordCycle(bCycleFrameBudgetExceeded, HasWorkUnitCountBudgetBeenExceeded());
+	}
+	bCycleFrameBudgetExceeded = false;
 	CycleWorkUnitsCompleted = 0;
-	CycleLastTimestamp = 0;
-	LastResetTimestamp = FPlatformTime::Seconds();
+	CycleLastCycles = 0;
+	LastResetCycles = FGWBClock::Cycles();
+	LastUsedFrame = GFrameCounter;
+	UpdateFrameBudgetExceededCycles();
 	UE_LOG(Log_GameplayWorkTimeSlicer, VeryVerbose, TEXT("UGWBTimeSlicer::Reset -> Remaining Budget: %f)"), GetRemainingTimeInBudget());
 }
 
 void UGWBTimeSlicer::StartWork()
 {
-	CycleLastTimestamp = FPlatformTime::Seconds();
-}
-
-void UGWBTimeSlicer::EndWork()
-{
-	CycleWorkUnitsCompleted++;
-	RecordTelemetry(FPlatformTime::Seconds() - CycleLastTimestamp);
-	UE_LOG(Log_GameplayWorkTimeSlicer, VeryVerbose, TEXT("UGWBTimeSlicer::EndWork -> Remaining Budget: %f)"), GetRemainingTimeInBudget());
+	StartWork(FGWBClock::Cycles());
 }
 
-bool UGWBTimeSlicer::HasBudgetBeenExceeded() const
+void UGWBTimeSlicer::StartWork(uint64 NowCycles)
 {
-	return HasWorkUnitCountBudgetBeenExceeded() || HasFrameBudgetBeenExceeded();
+	CycleLastCycles = NowCycles;
 }
 
-bool UGWBTimeSlicer::HasFrameBudgetBeenExceeded() const
+void UGWBTimeSlicer::EndWork()
 {
-	const auto RemainingTime = GetRemainingTimeInBudget();
-	const bool IsOutOfTime = RemainingTime <= DOUBLE_SMALL_NUMBER;
-	return FrameTimeBudget >= 0 ? IsOutOfTime : false;
+	EndWork(FGWBClock::Cycles());
 }
 
-bool UGWBTimeSlicer::HasWorkUnitCountBudgetBeenExceeded() const
+void UGWBTimeSlicer::EndWork(uint64 NowCycles)
 {
-	return WorkUnitCountBudget > 0 ? GetRemainingWorkUnitCountBudget() <= 0 : false;
+	CycleWorkUnitsCompleted++;
+	bCycleFrameBudgetExceeded |= HasFrameBudgetBeenExceeded(NowCycles);
+	Telemetry.RecordWorkDuration(NowCycles - CycleLastCycles);
+	UE_LOG(Log_GameplayWorkTimeSlicer, VeryVerbose, TEXT("UGWBTimeSlicer::EndWork -> Remaining Budget: %f)"), GetRemainingTimeInBudget());
 }
 
 float UGWBTimeSlicer::GetRemainingTimeInBudget() const
 {
-	return GetFrameBudgetExceededTimestamp() - FPlatformTime::Seconds();
+	return FrameTimeBudget - FGWBClock::ToSeconds(FGWBClock::Cycles() - LastResetCycles);
 }
 
 double UGWBTimeSlicer::GetFrameBudgetExceededTimestamp() const
 {
-	const auto Value = LastResetTimestamp + FrameTimeBudget;
+	const auto Value = GetLastResetTimestamp() + FrameTimeBudget;
 	return Value;
 }
 
@@ -77,7 +97,12 @@ uint32 UGWBTimeSlicer::GetRemainingWorkUnitCountBudget() const
 
 UGWBTimeSlicer* UGWBTimeSlicer::ConfigureTimeBudget(double FrameTimeBudgetIn)
 {
-	FrameTimeBudget = FrameTimeBudgetIn;
+	// loop scopes configure the same budget for every unit of work, only convert it when it actually changes
+	if (FrameTimeBudget != FrameTimeBudgetIn)
+	{
+		FrameTimeBudget = FrameTimeBudgetIn;
+		UpdateFrameBudgetExceededCycles();
+	}
 	return this;
 }
 
@@ -87,11 +112,27 @@ UGWBTimeSlicer* UGWBTimeSlicer::ConfigureWorkUnitCountBudget(uint32 WorkUnitCoun
 	return this;
 }
 
-void UGWBTimeSlicer::RecordTelemetry(const double WorkDuration)
+void UGWBTimeSlicer::UpdateFrameBudgetExceededCycles()
 {
-	const auto PastWeight = (UnitWorkDurations.Capacity()-1) / UnitWorkDurations.Capacity();
-	const auto NewEntryWeight = 1 / UnitWorkDurations.Capacity();
-	UnitWorkAverageDuration = NewEntryWeight * WorkDuration + PastWeight * UnitWorkAverageDuration;
-	UnitWorkDurations[WorkUnitsRecorded] = WorkDuration;
-	WorkUnitsRecorded += 1;
+	// a negative budget is unlimited, so it's never exceeded
+	FrameBudgetExceededCycles = FrameTimeBudget >= 0 ? LastResetCycles + FGWBClock::ToCycles(FrameTimeBudget) : MAX_uint64;
 }
+
+
+FGWBLoopCursor& UGWBTimeSlicer::AddLoopCursor(const void* LoopIdentity)
+{
+	// only new containers add cursors, so that's when the ones of containers no longer looped over are dropped (at most once every MaxIdleFrames)
+	const int32 MaxIdleFrames = FGWBTimeSlicerRegistry::GetMaxIdleFrames();
+	if (MaxIdleFrames > 0 && GFrameCounter - LastLoopCursorEvictionFrame >= static_cast<uint64>(MaxIdleFrames))
+	{
+		LastLoopCursorEvictionFrame = GFrameCounter;
+		for (auto It = LoopCursors.CreateIterator(); It; ++It)
+		{
+			if (GFrameCounter - It.Value().LastUsedFrame > static_cast<uint64>(MaxIdleFrames))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+	return LoopCursors.Add(LoopIdentity);
+}
\ No newline at end of file
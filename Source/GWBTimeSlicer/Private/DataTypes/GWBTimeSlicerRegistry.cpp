@@ -0,0 +1,88 @@
+#include "DataTypes/GWBTimeSlicerRegistry.h"
+#include "Components/GWBTimeSlicer.h"
+#include "GWBTimeSlicerModule.h"
+
+static TAutoConsoleVariable<int32> CVarGWB_TimeSlicerMaxIdleFrames(TEXT("gwb.timeslicer.maxidleframes"), 600, TEXT("Number of frames a time slicer may go unused before it's evicted from its registry (and garbage collected). Zero or negative values keep time slicers around until their world (or the engine) goes away."));
+
+FGWBTimeSlicerHandle FGWBTimeSlicerRegistry::GetTimeSlicerHandle(UObject* Outer, const FName& Id)
+{
+	if (const int32* Index = TimeSlicerIndices.Find(Id))
+	{
+		return FGWBTimeSlicerHandle(*Index, SerialNumbers[*Index], Id);
+	}
+
+	// only new slicers grow the registry, so that's when the idle ones are dropped (at most once every MaxIdleFrames)
+	const int32 MaxIdleFrames = GetMaxIdleFrames();
+	if (MaxIdleFrames > 0 && GFrameCounter - LastEvictionFrame >= static_cast<uint64>(MaxIdleFrames))
+	{
+		EvictIdleTimeSlicers(GFrameCounter, MaxIdleFrames);
+	}
+
+	UGWBTimeSlicer* TimeSlicer = NewObject<UGWBTimeSlicer>(Outer);
+	TimeSlicer->Init(Id);
+
+	// slots are reused after eviction, the serial number keeps handles to the evicted slicer from resolving to this one
+	int32 Index;
+	if (FreeIndices.Num() > 0)
+	{
+		Index = FreeIndices.Pop();
+		TimeSlicers[Index] = TimeSlicer;
+	}
+	else
+	{
+		Index = TimeSlicers.Add(TimeSlicer);
+		SerialNumbers.Add(0);
+	}
+	TimeSlicerIndices.Add(Id, Index);
+	return FGWBTimeSlicerHandle(Index, SerialNumbers[Index], Id);
+}
+
+int32 FGWBTimeSlicerRegistry::GetMaxIdleFrames()
+{
+	return CVarGWB_TimeSlicerMaxIdleFrames.GetValueOnGameThread();
+}
+
+int32 FGWBTimeSlicerRegistry::EvictIdleTimeSlicers(const uint64 FrameCounter, const int32 MaxIdleFrames)
+{
+	LastEvictionFrame = FrameCounter;
+	if (MaxIdleFrames <= 0) return 0;
+
+	int32 NumEvicted = 0;
+	for (auto It = TimeSlicerIndices.CreateIterator(); It; ++It)
+	{
+		const int32 Index = It.Value();
+		const UGWBTimeSlicer* TimeSlicer = TimeSlicers[Index];
+		if (TimeSlicer && FrameCounter - TimeSlicer->GetLastUsedFrame() <= static_cast<uint64>(MaxIdleFrames)) continue;
+
+		UE_LOG(Log_GameplayWorkTimeSlicer, VeryVerbose, TEXT("FGWBTimeSlicerRegistry::EvictIdleTimeSlicers -> Evicted: %s"), *It.Key().ToString());
+		TimeSlicers[Index] = nullptr;
+		SerialNumbers[Index]++;
+		FreeIndices.Add(Index);
+		It.RemoveCurrent();
+		NumEvicted++;
+	}
+	return NumEvicted;
+}
+
+void FGWBTimeSlicerRegistry::ForEachTimeSlicer(TFunctionRef<void(UGWBTimeSlicer&)> Function) const
+{
+	for (const TPair<FName, int32>& TimeSlicerIndex : TimeSlicerIndices)
+	{
+		if (UGWBTimeSlicer* TimeSlicer = TimeSlicers[TimeSlicerIndex.Value])
+		{
+			Function(*TimeSlicer);
+		}
+	}
+}
+
+void FGWBTimeSlicerRegistry::Empty()
+{
+	// same as evicting every slicer, so handles handed out before don't resolve to slicers created afterwards
+	for (const TPair<FName, int32>& TimeSlicerIndex : TimeSlicerIndices)
+	{
+		TimeSlicers[TimeSlicerIndex.Value] = nullptr;
+		SerialNumbers[TimeSlicerIndex.Value]++;
+		FreeIndices.Add(TimeSlicerIndex.Value);
+	}
+	TimeSlicerIndices.Empty();
+}
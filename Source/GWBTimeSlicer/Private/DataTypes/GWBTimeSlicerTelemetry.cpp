@@ -0,0 +1,33 @@
+#include "DataTypes/GWBTimeSlicerTelemetry.h"
+
+void FGWBTimeSlicerTelemetry::Reset()
+{
+	*this = FGWBTimeSlicerTelemetry();
+}
+
+double FGWBTimeSlicerTelemetry::GetPercentileDuration(const double Percentile) const
+{
+	if (NumWorkUnits == 0) return 0.0;
+
+	// walk the histogram up to the bucket the percentile falls in, and report the longest duration that bucket counts
+	const uint64 TargetCount = FMath::Clamp<uint64>(static_cast<uint64>(FMath::CeilToDouble(Percentile * NumWorkUnits)), 1, NumWorkUnits);
+	uint64 Count = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; BucketIndex++)
+	{
+		Count += Buckets[BucketIndex];
+		if (Count >= TargetCount)
+		{
+			return FGWBClock::ToSeconds(FMath::Min(GetBucketUpperBound(BucketIndex) - 1, MaxDurationCycles));
+		}
+	}
+	return GetMaxDuration();
+}
+
+uint64 FGWBTimeSlicerTelemetry::GetBucketUpperBound(const int32 BucketIndex)
+{
+	if (BucketIndex < NumSubBuckets) return BucketIndex + 1;
+	if (BucketIndex >= NumBuckets - 1) return MAX_uint64;
+	const uint32 Exponent = BucketIndex / NumSubBuckets + 1;
+	const uint64 SubBucket = BucketIndex % NumSubBuckets;
+	return (NumSubBuckets + SubBucket + 1) << (Exponent - 2);
+}
@@ -1,5 +1,63 @@
 #include "GWBTimeSlicersSubsystem.h"
 #include "Components/GWBTimeSlicer.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+namespace
+{
+	/** Calls the function with the subsystem the slicers of the context live in: the one of its world, or the engine wide one. */
+	template<typename FunctionType>
+	auto WithTimeSlicersSubsystem(const UObject* WorldContextObject, FunctionType&& Function)
+	{
+		const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+		if (UGWBWorldTimeSlicersSubsystem* WorldSubsystem = World ? World->GetSubsystem<UGWBWorldTimeSlicersSubsystem>() : nullptr)
+		{
+			return Function(*WorldSubsystem);
+		}
+		return Function(*GEngine->GetEngineSubsystem<UGWBTimeSlicersSubsystem>());
+	}
+
+	void DumpTelemetry(const FGWBTimeSlicerRegistry& Registry, const TCHAR* RegistryName, bool bReset, FOutputDevice& Ar)
+	{
+		Ar.Logf(TEXT("%s: %d time slicers"), RegistryName, Registry.Num());
+		Registry.ForEachTimeSlicer([bReset, &Ar](UGWBTimeSlicer& TimeSlicer)
+		{
+			const FGWBTimeSlicerTelemetry& Telemetry = TimeSlicer.GetTelemetry();
+			Ar.Logf(TEXT("  %s: Budget=%.3fms/%d units, Units=%llu, Avg=%.3fms, P50=%.3fms, P95=%.3fms, P99=%.3fms, Max=%.3fms, Cycles=%llu, OverFrameBudget=%llu, OverCountBudget=%llu"),
+				*TimeSlicer.GetId().ToString(),
+				TimeSlicer.GetFrameTimeBudget() * 1000.0,
+				static_cast<int32>(TimeSlicer.GetWorkUnitCountBudget()),
+				Telemetry.GetNumWorkUnits(),
+				Telemetry.GetAverageDuration() * 1000.0,
+				Telemetry.GetPercentileDuration(0.5) * 1000.0,
+				Telemetry.GetPercentileDuration(0.95) * 1000.0,
+				Telemetry.GetPercentileDuration(0.99) * 1000.0,
+				Telemetry.GetMaxDuration() * 1000.0,
+				Telemetry.GetNumCycles(),
+				Telemetry.GetNumFrameBudgetExceeded(),
+				Telemetry.GetNumWorkUnitCountBudgetExceeded());
+			if (bReset) TimeSlicer.ResetTelemetry();
+		});
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdGWB_TimeSlicerTelemetry(
+		TEXT("gwb.timeslicer.telemetry"),
+		TEXT("Prints the per unit durations (average, percentiles, max) and budget exceeded counts of every time slicer of the world and of the engine. Pass 'reset' to start the telemetry over after printing it."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const bool bReset = Args.Contains(TEXT("reset"));
+			if (const UGWBWorldTimeSlicersSubsystem* WorldSubsystem = World ? World->GetSubsystem<UGWBWorldTimeSlicersSubsystem>() : nullptr)
+			{
+				DumpTelemetry(WorldSubsystem->GetRegistry(), *World->GetName(), bReset, Ar);
+			}
+			if (const UGWBTimeSlicersSubsystem* EngineSubsystem = GEngine ? GEngine->GetEngineSubsystem<UGWBTimeSlicersSubsystem>() : nullptr)
+			{
+				DumpTelemetry(EngineSubsystem->GetRegistry(), TEXT("Engine"), bReset, Ar);
+			}
+		}));
+}
 
 void UGWBTimeSlicersSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -8,16 +66,42 @@ void UGWBTimeSlicersSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UGWBTimeSlicersSubsystem::Deinitialize()
 {
+	Registry.Empty();
 	Super::Deinitialize();
 }
 
+FGWBTimeSlicerHandle UGWBTimeSlicersSubsystem::GetTimeSlicerHandle(const UObject* WorldContextObject, const FName& Id)
+{
+	return WithTimeSlicersSubsystem(WorldContextObject, [&Id](auto& Subsystem) { return Subsystem.GetTimeSlicerHandle(Id); });
+}
+
+UGWBTimeSlicer* UGWBTimeSlicersSubsystem::GetTimeSlicer(const UObject* WorldContextObject, const FGWBTimeSlicerHandle Handle)
+{
+	return WithTimeSlicersSubsystem(WorldContextObject, [Handle](auto& Subsystem) { return Subsystem.GetTimeSlicer(Handle); });
+}
+
 UGWBTimeSlicer* UGWBTimeSlicersSubsystem::GetTimeSlicer(const FName& Id)
 {
-	if (!TimeSlicers.Contains(Id))
-	{
-		TimeSlicers.Add(Id, NewObject<UGWBTimeSlicer>());
-		TimeSlicers[Id]->Init();
-	}
+	return GetTimeSlicer(GetTimeSlicerHandle(Id));
+}
+
+FGWBTimeSlicerHandle UGWBTimeSlicersSubsystem::GetTimeSlicerHandle(const FName& Id)
+{
+	return Registry.GetTimeSlicerHandle(this, Id);
+}
 
-	return TimeSlicers[Id];
-}
\ No newline at end of file
+void UGWBWorldTimeSlicersSubsystem::Deinitialize()
+{
+	Registry.Empty();
+	Super::Deinitialize();
+}
+
+UGWBTimeSlicer* UGWBWorldTimeSlicersSubsystem::GetTimeSlicer(const FName& Id)
+{
+	return GetTimeSlicer(GetTimeSlicerHandle(Id));
+}
+
+FGWBTimeSlicerHandle UGWBWorldTimeSlicersSubsystem::GetTimeSlicerHandle(const FName& Id)
+{
+	return Registry.GetTimeSlicerHandle(this, Id);
+}
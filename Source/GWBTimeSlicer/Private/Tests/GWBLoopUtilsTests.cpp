@@ -1,8 +1,13 @@
 ﻿#include "Utils/GWBLoopUtils.h"
 #include "Components/GWBTimeSlicer.h"
+#include "DataTypes/GWBStackTimeSlicer.h"
+#include "Engine/World.h"
+#include "GWBTimeSlicersSubsystem.h"
 #include "Misc/AutomationTest.h"
+#include "UObject/UObjectIterator.h"
 #include "Tests/ScopedCvarOverrides.h"
 #include "Tests/SlicerTestMocks.h"
+#include "Tests/ScopedVirtualClock.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -83,6 +88,7 @@ void FGWBLoopUtilsTests::Define()
 
 		It("should respect time budget and process partial elements", [this]()
 		{
+			FScopedVirtualClock Clock;
 			FScopedCVarOverrideFloat FrameBudget(TEXT("gwb.budget.frame"), 0.001f); // Very small budget
 			
 			// Set up a larger array to ensure we hit budget limits
@@ -90,12 +96,11 @@ void FGWBLoopUtilsTests::Define()
 			
 			BUDGETED_FOR_LOOP(WorldContext, 0.001f, 100, TestArray, [&](FBudgetedLoopHandle& Handle) {
 				ProcessedCount++;
-				// Add small delay to consume time budget
-				FPlatformProcess::Sleep(0.0005f);
+				// Simulate work that uses up half of the time budget
+				Clock.AdvanceSeconds(0.0005f);
 			});
 			
-			TestTrue("Should process fewer elements than total due to budget", ProcessedCount < TestArray.Num());
-			TestTrue("Should process at least one element", ProcessedCount > 0);
+			TestEqual("Should process as many elements as fit in the time budget", ProcessedCount, 2);
 		});
 
 		It("should respect work unit count budget", [this]()
@@ -186,9 +191,11 @@ void FGWBLoopUtilsTests::Define()
 
 		It("should respect time budget constraints", [this]()
 		{
+			FScopedVirtualClock Clock;
 			FScopedCVarOverrideFloat FrameBudget(TEXT("gwb.budget.frame"), 0.001f);
 			
 			TestHelper->SetSleepDuration(0.0005f);
+			TestHelper->SetVirtualClock(&Clock);
 			
 			FGWBBudgetedLoopWorkDelegate WorkDelegate;
 			WorkDelegate.BindUFunction(TestHelper, FName("ProcessWorkUnit"));
@@ -198,7 +205,7 @@ void FGWBLoopUtilsTests::Define()
 				WorldContext, 0.001f, 100, TestArray.Num(), WorkDelegate, TEXT("TestLoop2")
 			);
 			
-			TestTrue("Should process fewer elements due to time budget", TestHelper->ProcessedCount < TestArray.Num());
+			TestEqual("Should process as many elements as fit in the time budget", TestHelper->ProcessedCount, 2);
 		});
 
 		It("should respect work unit count budget", [this]()
@@ -256,15 +263,75 @@ void FGWBLoopUtilsTests::Define()
 		});
 	});
 
+	Describe("Latent Blueprint Budgeted For Loop", [this]()
+	{
+		It("should carry on across frames until completed", [this]()
+		{
+			UGWBBudgetedForLoopAction* Action = UGWBBudgetedForLoopAction::BudgetedForLoopLatent(WorldContext, 1.0f, 4, TestArray.Num());
+			TestHelper->LatentAction = Action;
+			Action->LoopBody.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::ProcessLatentLoopBody);
+			Action->Completed.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::OnLatentLoopCompleted);
+			Action->Broken.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::OnLatentLoopBroken);
+
+			Action->Activate();
+			TestEqual("Activation should run the first frame's iterations", TestHelper->ProcessedCount, 4);
+			TestTrue("Loop should keep running", Action->IsRunning());
+
+			Action->RunFrame();
+			Action->RunFrame();
+			TestTrue("Every element should be visited once in order", TestHelper->LatentIndices == TestArray);
+			TestEqual("Completed should fire with the element count", TestHelper->LatentCompletedIndex, TestArray.Num());
+			TestEqual("Broken should not fire", TestHelper->LatentBrokenIndex, INDEX_NONE);
+			TestFalse("Loop should stop once completed", Action->IsRunning());
+		});
+
+		It("should stop when broken", [this]()
+		{
+			UGWBBudgetedForLoopAction* Action = UGWBBudgetedForLoopAction::BudgetedForLoopLatent(WorldContext, 1.0f, 4, TestArray.Num());
+			TestHelper->LatentAction = Action;
+			TestHelper->SetBreakAtCount(6);
+			Action->LoopBody.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::ProcessLatentLoopBody);
+			Action->Completed.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::OnLatentLoopCompleted);
+			Action->Broken.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::OnLatentLoopBroken);
+
+			Action->Activate();
+			Action->RunFrame();
+			TestEqual("Loop should stop on the element it was broken on", TestHelper->ProcessedCount, 6);
+			TestEqual("Broken should fire with the element's index", TestHelper->LatentBrokenIndex, 5);
+			TestEqual("Completed should not fire", TestHelper->LatentCompletedIndex, INDEX_NONE);
+			TestFalse("Loop should stop once broken", Action->IsRunning());
+			TestFalse("Later ticks should do nothing", Action->RunFrame());
+		});
+
+		It("should stop without another iteration when broken between ticks", [this]()
+		{
+			UGWBBudgetedForLoopAction* Action = UGWBBudgetedForLoopAction::BudgetedForLoopLatent(WorldContext, 1.0f, 4, TestArray.Num());
+			TestHelper->LatentAction = Action;
+			Action->LoopBody.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::ProcessLatentLoopBody);
+			Action->Completed.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::OnLatentLoopCompleted);
+			Action->Broken.AddDynamic(TestHelper, &UGWBLoopUtilsTestHelper::OnLatentLoopBroken);
+
+			Action->Activate();
+			Action->Break();
+			TestFalse("Tick after the break should end the loop", Action->RunFrame());
+			TestEqual("Loop body should not fire after the break", TestHelper->ProcessedCount, 4);
+			TestEqual("Broken should fire with the last element's index", TestHelper->LatentBrokenIndex, 3);
+			TestEqual("Completed should not fire", TestHelper->LatentCompletedIndex, INDEX_NONE);
+			TestFalse("Loop should stop once broken", Action->IsRunning());
+		});
+	});
+
 	Describe("Cross-Tick Behavior with Break", [this]()
 	{
 		It("should maintain state across multiple calls with break capability", [this]()
 		{
+			FScopedVirtualClock Clock;
 			FScopedCVarOverrideFloat FrameBudget(TEXT("gwb.budget.frame"), 0.001f);
 			const FString CallSiteId = TEXT("CrossTickBreakTest");
 			
 			TestHelper->SetBreakAtCount(5);
 			TestHelper->SetSleepDuration(0.0002f);
+			TestHelper->SetVirtualClock(&Clock);
 			
 			FGWBBudgetedLoopWorkDelegate WorkDelegate;
 			WorkDelegate.BindUFunction(TestHelper, FName("ProcessWorkUnit"));
@@ -282,6 +349,314 @@ void FGWBLoopUtilsTests::Define()
 		});
 	});
 
+	Describe("Resumable Budgeted Loops", [this]()
+	{
+		It("should resume from where the previous call stopped", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("ResumableLoopSlicer")));
+			TimeSlicer->ResetLoopCursors();
+			TArray<int32> VisitedIndices;
+			TArray<FGWBBudgetedLoopResult> Results;
+			for (int32 Frame = 0; Frame < 3; ++Frame)
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 4);
+				Results.Add(GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, &TestArray, TestArray.Num(), [&](FBudgetedLoopHandle& Handle) {
+					VisitedIndices.Add(Handle.GetIndex());
+				}));
+			}
+
+			TestTrue("Every element should be visited once in order", VisitedIndices == TestArray);
+			TestEqual("Second call should start where the first stopped", Results[1].StartIndex, 4);
+			TestEqual("Last call should only get the remaining elements", Results[2].NumProcessed, 2);
+			TestFalse("Partial passes should not be completed", Results[0].bCompleted || Results[1].bCompleted);
+			TestTrue("Last call should complete the pass", Results[2].bCompleted);
+		});
+
+		It("should report wrapping around after a completed pass", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("WrappingLoopSlicer")));
+			TimeSlicer->ResetLoopCursors();
+			TArray<FGWBBudgetedLoopResult> Results;
+			for (int32 Frame = 0; Frame < 3; ++Frame)
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 6);
+				Results.Add(GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, &TestArray, TestArray.Num(), [&](FBudgetedLoopHandle& Handle) {}));
+			}
+
+			TestTrue("Second call should complete the pass", Results[1].bCompleted);
+			TestFalse("Calls within a pass should not wrap around", Results[0].bWrappedAround || Results[1].bWrappedAround);
+			TestTrue("Call after a completed pass should wrap around", Results[2].bWrappedAround);
+			TestEqual("Call after a completed pass should start over", Results[2].StartIndex, 0);
+		});
+
+		It("should start over when the array changes size", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("ChangingLoopSlicer")));
+			TimeSlicer->ResetLoopCursors();
+			auto RunFrame = [TimeSlicer](const TArray<int32>& Array)
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 3);
+				return GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, &Array, Array.Num(), [](FBudgetedLoopHandle& Handle) {});
+			};
+
+			RunFrame(TestArray);
+			TestEqual("Same array should resume", RunFrame(TestArray).StartIndex, 3);
+			TestArray.Add(10);
+			TestEqual("Resized array should start over", RunFrame(TestArray).StartIndex, 0);
+		});
+
+		It("should keep a cursor per array when arrays alternate on one call site", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("AlternatingLoopSlicer")));
+			TimeSlicer->ResetLoopCursors();
+			TArray<int32> OtherArray = TestArray;
+			TArray<int32> VisitedIndices;
+			TArray<int32> OtherVisitedIndices;
+			auto RunFrame = [TimeSlicer](TArray<int32>& Array, TArray<int32>& Visited)
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 3);
+				return GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, GWBLoopUtils::Private::MakeLoopRange(Array), [&Visited](int32& Element, int32 Index, FBudgetedLoopHandle& Handle) {
+					Visited.Add(Element);
+				});
+			};
+
+			// like a per-actor Tick, both arrays are looped over at the same call site every frame
+			TArray<FGWBBudgetedLoopResult> Results;
+			TArray<FGWBBudgetedLoopResult> OtherResults;
+			for (int32 Frame = 0; Frame < 4; ++Frame)
+			{
+				Results.Add(RunFrame(TestArray, VisitedIndices));
+				OtherResults.Add(RunFrame(OtherArray, OtherVisitedIndices));
+			}
+
+			TestEqual("Call site should keep a cursor per array", TimeSlicer->GetNumLoopCursors(), 2);
+			TestEqual("Array should resume after the other one ran", Results[1].StartIndex, 3);
+			TestEqual("Other array should resume after the first one ran", OtherResults[1].StartIndex, 3);
+			TestTrue("Every element of the array should be visited once in order", VisitedIndices == TestArray);
+			TestTrue("Every element of the other array should be visited once in order", OtherVisitedIndices == OtherArray);
+			TestTrue("Both arrays should complete their pass", Results[3].bCompleted && OtherResults[3].bCompleted);
+		});
+
+		It("should start over after a break", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("BrokenLoopSlicer")));
+			TimeSlicer->ResetLoopCursors();
+			FGWBBudgetedLoopResult Result;
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 0);
+				Result = GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, &TestArray, TestArray.Num(), [](FBudgetedLoopHandle& Handle) {
+					if (Handle.GetIndex() == 2) Handle.Break();
+				});
+			}
+			TestTrue("Loop should report the break", Result.bBroken);
+			TestEqual("Element the break was called on should count as processed", Result.NumProcessed, 3);
+			TestFalse("Broken pass should not be completed", Result.bCompleted);
+
+			FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 0);
+			Result = GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, &TestArray, TestArray.Num(), [](FBudgetedLoopHandle& Handle) {});
+			TestEqual("Call after a break should start over", Result.StartIndex, 0);
+			TestFalse("Call after a break should not wrap around", Result.bWrappedAround);
+		});
+
+		It("should resume Blueprint loops per call site", [this]()
+		{
+			const FString CallSiteId = TEXT("ResumableBlueprintLoop");
+			UGWBTimeSlicer::Get(WorldContext, FName(*CallSiteId))->ResetLoopCursors();
+			FGWBBudgetedLoopWorkDelegate WorkDelegate;
+			WorkDelegate.BindUFunction(TestHelper, FName("ProcessWorkUnit"));
+
+			const FGWBBudgetedLoopResult First = UGWBLoopUtilsBlueprintLibrary::BudgetedForLoopBlueprint(
+				WorldContext, 1.0f, 7, TestArray.Num(), WorkDelegate, CallSiteId
+			);
+			const FGWBBudgetedLoopResult Second = UGWBLoopUtilsBlueprintLibrary::BudgetedForLoopBlueprint(
+				WorldContext, 1.0f, 7, TestArray.Num(), WorkDelegate, CallSiteId
+			);
+
+			TestEqual("Second call should start where the first stopped", Second.StartIndex, 7);
+			TestEqual("Both calls together should process every element once", TestHelper->ProcessedCount, TestArray.Num());
+			TestTrue("Second call should complete the pass", !First.bCompleted && Second.bCompleted);
+		});
+	});
+
+	Describe("Range Budgeted Loops", [this]()
+	{
+		It("should pass array elements by reference with their index", [this]()
+		{
+			TArray<int32> Indices;
+			BUDGETED_FOR_LOOP(WorldContext, 1.0f, 100, TestArray, [&](int32& Element, int32 Index, FBudgetedLoopHandle& Handle) {
+				Indices.Add(Index);
+				Element *= 2;
+			});
+
+			TestEqual("Every element should be visited", Indices.Num(), 10);
+			TestTrue("Indices should match the elements", Indices.Num() == 10 && Indices[9] == 9);
+			TestEqual("Elements should be modified in place", TestArray[9], 18);
+		});
+
+		It("should loop over array views of the same elements as one loop", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("ArrayViewLoopSlicer")));
+			TimeSlicer->ResetLoopCursors();
+			int32 Sum = 0;
+			for (int32 Frame = 0; Frame < 2; ++Frame)
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 5);
+				TArrayView<const int32> View = MakeArrayView(TestArray);
+				GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, GWBLoopUtils::Private::MakeLoopRange(View), [&](const int32& Element, int32 Index, FBudgetedLoopHandle& Handle) {
+					Sum += Element;
+				});
+			}
+
+			TestEqual("Second view should resume where the first stopped", Sum, 45);
+		});
+
+		It("should resume sets and maps by walking past the done elements", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("SetLoopSlicer")));
+			TimeSlicer->ResetLoopCursors();
+			const TSet<int32> Set(TestArray);
+			TSet<int32> Visited;
+			TArray<FGWBBudgetedLoopResult> Results;
+			for (int32 Frame = 0; Frame < 3; ++Frame)
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 4);
+				Results.Add(GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, GWBLoopUtils::Private::MakeLoopRange(Set), [&](const int32& Element, int32 Index, FBudgetedLoopHandle& Handle) {
+					Visited.Add(Element);
+				}));
+			}
+			TestEqual("Every element of the set should be visited once", Visited.Num(), Set.Num());
+			TestTrue("Last call should complete the set", Results[2].bCompleted);
+
+			TMap<int32, int32> Map;
+			for (const int32 Element : TestArray) Map.Add(Element, Element * 10);
+			int32 Sum = 0;
+			BUDGETED_FOR_LOOP(WorldContext, 1.0f, 100, Map, [&](TPair<int32, int32>& Pair, int32 Index, FBudgetedLoopHandle& Handle) {
+				Sum += Pair.Value;
+			});
+			TestEqual("Map pairs should be passed", Sum, 450);
+		});
+
+		It("should loop over iterators until they're done", [this]()
+		{
+			bool bFoundWorldContext = false;
+			const FGWBBudgetedLoopResult Result = BUDGETED_FOR_LOOP(WorldContext, 1.0f, 0, TObjectIterator<UGWBTestWorldContext>(), [&](UGWBTestWorldContext* Object, int32 Index, FBudgetedLoopHandle& Handle) {
+				bFoundWorldContext |= Object == WorldContext;
+			});
+
+			TestTrue("Iterator should visit the objects", bFoundWorldContext);
+			TestTrue("Iterator should complete the pass", Result.bCompleted);
+		});
+	});
+
+	Describe("Budgeted Parallel For", [this]()
+	{
+		It("should resume where the count budget ran out", [this]()
+		{
+			SetupTestArray(1000);
+			TArray<int32> Visits;
+			Visits.SetNumZeroed(TestArray.Num());
+			TArray<FGWBBudgetedLoopResult> Results;
+			int32 NextIndex = 0;
+			for (int32 Frame = 0; Frame < 3; ++Frame)
+			{
+				Results.Add(GWBLoopUtils::BudgetedParallelFor(1.0, 400, TestArray, NextIndex, [&Visits](const int32& Element, int32 Index) {
+					Visits[Index] += Element == Index ? 1 : 100;
+				}, 16));
+				NextIndex = Results.Last().GetNextIndex();
+			}
+
+			TestEqual("Second frame should start where the count budget ran out", Results[1].StartIndex, 400);
+			TestEqual("Last frame should only get the remaining elements", Results[2].NumProcessed, 200);
+			TestTrue("Last frame should complete the pass", Results[2].bCompleted && !Results[1].bCompleted);
+			TestEqual("Next frame should start over", NextIndex, 0);
+			TestFalse("Every element should be visited once with its own index", Visits.ContainsByPredicate([](int32 NumVisits) { return NumVisits != 1; }));
+		});
+
+		It("should stop handing out chunks once the time budget ran out", [this]()
+		{
+			FScopedVirtualClock Clock;
+			SetupTestArray(100000);
+			TArray<int32> Visits;
+			Visits.SetNumZeroed(TestArray.Num());
+			const FGWBBudgetedLoopResult Result = GWBLoopUtils::BudgetedParallelFor(0.001, 0, TestArray, 0, [&Visits, &Clock](const int32& Element, int32 Index) {
+				Visits[Index]++;
+				// every chunk uses up the budget, so each thread finishes the chunk it claimed and stops
+				if (Index % 100 == 0) Clock.AdvanceSeconds(0.002);
+			}, 100);
+
+			TestTrue("Some but not all chunks should be processed", Result.NumProcessed >= 100 && Result.NumProcessed < TestArray.Num());
+			TestEqual("Only whole chunks should be processed", Result.NumProcessed % 100, 0);
+			TestEqual("Next frame should start after the processed elements", Result.GetNextIndex(), Result.NumProcessed);
+			bool bOnlyProcessedVisited = true;
+			for (int32 Index = 0; Index < Visits.Num(); ++Index)
+			{
+				bOnlyProcessedVisited &= Visits[Index] == (Index < Result.NumProcessed ? 1 : 0);
+			}
+			TestTrue("Exactly the elements before the next index should be visited", bOnlyProcessedVisited);
+		});
+
+		It("should process the first chunk even when the budget is already used up", [this]()
+		{
+			// the clock doesn't move and the budget rounds down to no time at all, so the deadline has passed before any chunk is claimed
+			FScopedVirtualClock Clock;
+			SetupTestArray(1000);
+			TArray<FGWBBudgetedLoopResult> Results;
+			int32 NextIndex = 0;
+			for (int32 Frame = 0; Frame < 2; ++Frame)
+			{
+				Results.Add(GWBLoopUtils::BudgetedParallelFor(1e-12, 0, TestArray, NextIndex, [](const int32& Element, int32 Index) {}, 100));
+				NextIndex = Results.Last().GetNextIndex();
+			}
+
+			TestTrue("At least the first chunk should be processed", Results[0].NumProcessed >= 100);
+			TestEqual("Only whole chunks should be processed", Results[0].NumProcessed % 100, 0);
+			TestEqual("Next frame should start after the processed elements", Results[1].StartIndex, Results[0].NumProcessed);
+			TestTrue("Next frame should make progress too", Results[1].NumProcessed >= 100);
+		});
+	});
+
+	Describe("Loop Call Sites", [this]()
+	{
+		It("should hash call sites at compile time", [this]()
+		{
+			constexpr uint32 Hash = GWBLoopUtils::HashCallSite("GWBLoopUtilsTests.cpp", 1);
+			static_assert(Hash != GWBLoopUtils::HashCallSite("GWBLoopUtilsTests.cpp", 2), "call sites on other lines should get other hashes");
+
+			FGWBLoopCallSite& CallSite = GWBLoopUtils::GetLoopCallSite<Hash>();
+			TestTrue("Call site should be a static per hash", &CallSite == &GWBLoopUtils::GetLoopCallSite<Hash>());
+			TestTrue("Runtime hashes should find their own call sites", &FGWBLoopCallSite::FindOrAdd(Hash) == &FGWBLoopCallSite::FindOrAdd(Hash));
+			TestEqual("Call site should name its slicer after the hash", CallSite.GetId(), FName(*FString::Printf(TEXT("BudgetedLoop_%u"), Hash)));
+		});
+
+		It("should resolve the slicer of the context's registry", [this]()
+		{
+			FGWBLoopCallSite& CallSite = GWBLoopUtils::GetLoopCallSite<GWBLoopUtils::HashCallSite(__FILE__, __LINE__)>();
+			TestTrue("Call site should resolve to its named slicer", CallSite.Resolve(WorldContext) == UGWBTimeSlicer::Get(WorldContext, CallSite.GetId()));
+
+			UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+			TestTrue("Call site should resolve in another world", CallSite.Resolve(World) == UGWBTimeSlicer::Get(World, CallSite.GetId()));
+			TestTrue("Call site should resolve its cached handle in the same world", CallSite.Resolve(World) == UGWBTimeSlicer::Get(World, CallSite.GetId()));
+			TestTrue("Call site should resolve back outside of the world", CallSite.Resolve(WorldContext) == UGWBTimeSlicer::Get(WorldContext, CallSite.GetId()));
+			TestTrue("Call site should resolve again in the world after leaving it", CallSite.Resolve(World) == UGWBTimeSlicer::Get(World, CallSite.GetId()));
+			World->DestroyWorld(false);
+		});
+
+#if GWB_HAS_SOURCE_LOCATION
+		It("should only hash source locations passed at runtime once", [this]()
+		{
+			auto GetCallSite = [](const std::source_location& Location = std::source_location::current()) -> FGWBLoopCallSite&
+			{
+				return GWBLoopUtils::FindLoopCallSite(Location);
+			};
+			FGWBLoopCallSite& CallSite = GetCallSite();
+			const std::source_location Location = std::source_location::current();
+			TestTrue("Cached location should find its call site", &GWBLoopUtils::FindLoopCallSite(Location) == &FGWBLoopCallSite::FindOrAdd(GWBLoopUtils::HashCallSite(Location)));
+			TestTrue("Cached location should find the same call site again", &GWBLoopUtils::FindLoopCallSite(Location) == &GWBLoopUtils::FindLoopCallSite(Location));
+			TestTrue("Other locations should find other call sites", &CallSite != &GWBLoopUtils::FindLoopCallSite(Location));
+		});
+#endif
+	});
+
 	Describe("Break Handle Functionality", [this]()
 	{
 		It("should break immediately when Break() is called", [this]()
@@ -324,6 +699,191 @@ void FGWBLoopUtilsTests::Define()
 			TestEqual("Should break at element 3", ProcessedCount, 3);
 		});
 	});
+
+	Describe("Time Slicer Registry", [this]()
+	{
+		It("should resolve handles to the same slicer as the lookup by name", [this]()
+		{
+			const FName Id(TEXT("RegistryTestSlicer"));
+			const FGWBTimeSlicerHandle Handle = UGWBTimeSlicer::GetHandle(WorldContext, Id);
+			const FGWBTimeSlicerHandle OtherHandle = UGWBTimeSlicer::GetHandle(WorldContext, FName(TEXT("OtherRegistryTestSlicer")));
+
+			TestTrue("Handle should be valid", Handle.IsValid());
+			TestTrue("Handle should be stable", Handle == UGWBTimeSlicer::GetHandle(WorldContext, Id));
+			TestTrue("Different ids should get different handles", Handle != OtherHandle);
+			TestTrue("Handle should resolve to the named slicer", UGWBTimeSlicer::Resolve(WorldContext, Handle) == UGWBTimeSlicer::Get(WorldContext, Id));
+			TestEqual("Resolved slicer should know its id", UGWBTimeSlicer::Resolve(WorldContext, Handle)->GetId(), Id);
+			TestNull("Invalid handle should not resolve", UGWBTimeSlicer::Resolve(WorldContext, FGWBTimeSlicerHandle()));
+		});
+
+		It("should share a resolved slicer between loop scopes", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Resolve(WorldContext, UGWBTimeSlicer::GetHandle(WorldContext, FName(TEXT("ResolvedLoopSlicer"))));
+			FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 3);
+			for (int32 Index = 0; Index < TestArray.Num(); ++Index)
+			{
+				FGWBTimeSlicedLoopScope TimeSlicedWork = TimeSlicedScope.StartLoopScope();
+				if (TimeSlicedWork.IsOverBudget()) break;
+				ProcessedCount++;
+			}
+
+			TestEqual("Should process exactly the work count budget", ProcessedCount, 3);
+			TestEqual("Loop scopes should have used up the resolved slicer", TimeSlicer->GetCycleWorkUnitsCompleted(), 4u);
+		});
+
+		It("should budget work units on the stack", [this]()
+		{
+			FGWBStackTimeSlicer TimeSlicer(1.0, 4);
+			for (int32 Index = 0; Index < TestArray.Num(); ++Index)
+			{
+				if (TimeSlicer.HasBudgetBeenExceeded()) break;
+				TimeSlicer.StartWork();
+				ProcessedCount++;
+				TimeSlicer.EndWork();
+			}
+
+			TestEqual("Should process exactly the work count budget", ProcessedCount, 4);
+			TestFalse("Time budget should not be exceeded", TimeSlicer.HasFrameBudgetBeenExceeded());
+			TestEqual("No work units should remain", TimeSlicer.GetRemainingWorkUnitCountBudget(), 0);
+		});
+
+		It("should treat a negative time budget as unlimited on the stack", [this]()
+		{
+			FGWBStackTimeSlicer TimeSlicer(-1.0, 0);
+			TestFalse("Negative time budget should never be exceeded", TimeSlicer.HasBudgetBeenExceeded());
+		});
+
+		It("should evict idle slicers and stop resolving their handles", [this]()
+		{
+			FGWBTimeSlicerRegistry Registry;
+			const FName Id(TEXT("IdleSlicer"));
+			const FGWBTimeSlicerHandle Handle = Registry.GetTimeSlicerHandle(WorldContext, Id);
+			UGWBTimeSlicer* TimeSlicer = Registry.GetTimeSlicer(Handle);
+
+			TestEqual("Slicers used within the idle frames should be kept", Registry.EvictIdleTimeSlicers(GFrameCounter + 10, 10), 0);
+			TestTrue("Kept slicer should still resolve", Registry.GetTimeSlicer(Handle) == TimeSlicer);
+			TestEqual("Slicers idle for longer should be evicted", Registry.EvictIdleTimeSlicers(GFrameCounter + 11, 10), 1);
+			TestEqual("Registry should be empty", Registry.Num(), 0);
+			TestNull("Handle of an evicted slicer should not resolve", Registry.GetTimeSlicer(Handle));
+
+			const FGWBTimeSlicerHandle NewHandle = Registry.GetTimeSlicerHandle(WorldContext, Id);
+			TestEqual("New slicer should reuse the slot", NewHandle.GetIndex(), Handle.GetIndex());
+			TestTrue("New slicer should get a new handle", NewHandle != Handle);
+			TestTrue("New slicer should be a new object", Registry.GetTimeSlicer(NewHandle) != TimeSlicer);
+			TestNull("Old handle should not resolve to the new slicer", Registry.GetTimeSlicer(Handle));
+		});
+
+		It("should keep the slicers of a world in that world and tear them down with it", [this]()
+		{
+			UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+			const FName Id(TEXT("WorldSlicer"));
+			UGWBTimeSlicer* WorldTimeSlicer = UGWBTimeSlicer::Get(World, Id);
+			const FGWBTimeSlicerHandle Handle = UGWBTimeSlicer::GetHandle(World, Id);
+			UGWBWorldTimeSlicersSubsystem* Subsystem = World->GetSubsystem<UGWBWorldTimeSlicersSubsystem>();
+
+			TestNotNull("World should have a time slicers subsystem", Subsystem);
+			TestTrue("Contexts in the world should share its slicer", UGWBTimeSlicer::Resolve(World, Handle) == WorldTimeSlicer);
+			TestTrue("Contexts outside of the world should get another slicer", UGWBTimeSlicer::Get(WorldContext, Id) != WorldTimeSlicer);
+
+			World->DestroyWorld(false);
+			TestNull("Slicers of the world should be torn down with it", Subsystem ? Subsystem->GetTimeSlicer(Handle) : nullptr);
+		});
+	});
+
+	Describe("Time Slicer Clock", [this]()
+	{
+		It("should precompute the frame budget deadline in cycles", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("ClockTestSlicer")));
+			TimeSlicer->ConfigureTimeBudget(0.5)->ConfigureWorkUnitCountBudget(0)->Reset();
+			const uint64 ResetCycles = TimeSlicer->GetLastResetCycles();
+			const uint64 BudgetCycles = FGWBClock::ToCycles(0.5);
+
+			TestFalse("Budget should not be exceeded right after the reset", TimeSlicer->HasFrameBudgetBeenExceeded(ResetCycles));
+			TestFalse("Budget should not be exceeded just before the deadline", TimeSlicer->HasFrameBudgetBeenExceeded(ResetCycles + BudgetCycles - 1));
+			TestTrue("Budget should be exceeded at the deadline", TimeSlicer->HasFrameBudgetBeenExceeded(ResetCycles + BudgetCycles));
+
+			TimeSlicer->ConfigureTimeBudget(1.0);
+			TestFalse("Reconfiguring the budget should move the deadline", TimeSlicer->HasFrameBudgetBeenExceeded(ResetCycles + BudgetCycles));
+
+			TimeSlicer->ConfigureTimeBudget(-1.0);
+			TestFalse("Negative budget should never be exceeded", TimeSlicer->HasFrameBudgetBeenExceeded(MAX_uint64 - 1));
+		});
+
+		It("should share the timestamps of a loop scope with its caller", [this]()
+		{
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("ClockTestLoopSlicer")));
+			FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 1.0, 0);
+			const uint64 StartCycles = FGWBClock::Cycles();
+			{
+				FGWBTimeSlicedLoopScope TimeSlicedWork(TimeSlicer, 1.0, 0, StartCycles);
+				TestTrue("Work should start at the caller's timestamp", TimeSlicer->GetCycleLastCycles() == StartCycles);
+				TimeSlicedWork.EndWork(StartCycles + 1);
+				TestEqual("Ending the work early should count it", TimeSlicer->GetCycleWorkUnitsCompleted(), 1u);
+			}
+			TestEqual("Work that was ended early should not be counted again", TimeSlicer->GetCycleWorkUnitsCompleted(), 1u);
+		});
+
+		It("should precompute the frame budget deadline on the stack", [this]()
+		{
+			FGWBStackTimeSlicer TimeSlicer(0.0, 0);
+			TestTrue("Zero budget should be exceeded right away", TimeSlicer.HasFrameBudgetBeenExceeded(FGWBClock::Cycles()));
+		});
+	});
+
+	Describe("Time Slicer Telemetry", [this]()
+	{
+		It("should report percentiles of the per unit durations", [this]()
+		{
+			FScopedVirtualClock Clock;
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("TelemetryPercentilesSlicer")));
+			TimeSlicer->ResetTelemetry();
+			for (int32 Index = 0; Index < 100; ++Index)
+			{
+				TimeSlicer->StartWork();
+				Clock.AdvanceSeconds(Index == 98 ? 0.005 : Index == 99 ? 0.01 : 0.001);
+				TimeSlicer->EndWork();
+			}
+
+			const FGWBTimeSlicerTelemetry& Telemetry = TimeSlicer->GetTelemetry();
+			TestTrue("All units should be recorded", Telemetry.GetNumWorkUnits() == 100);
+			TestTrue("P50 should be within a bucket of the typical duration", Telemetry.GetPercentileDuration(0.5) > 0.00099 && Telemetry.GetPercentileDuration(0.5) < 0.00125);
+			TestTrue("P99 should be within a bucket of the second longest duration", Telemetry.GetPercentileDuration(0.99) > 0.00499 && Telemetry.GetPercentileDuration(0.99) < 0.00625);
+			TestEqual("Max should be the longest duration", Telemetry.GetMaxDuration(), 0.01, 1e-6);
+			TestTrue("Average should lean towards the latest durations", Telemetry.GetAverageDuration() > 0.001 && Telemetry.GetAverageDuration() < 0.01);
+		});
+
+		It("should count the cycles that went over their budgets", [this]()
+		{
+			FScopedVirtualClock Clock;
+			UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicer::Get(WorldContext, FName(TEXT("TelemetryBudgetsSlicer")));
+			TimeSlicer->Reset();
+			TimeSlicer->ResetTelemetry();
+			for (int32 Frame = 0; Frame < 2; ++Frame)
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, 0.001, 0);
+				for (int32 Index = 0; Index < TestArray.Num(); ++Index)
+				{
+					FGWBTimeSlicedLoopScope TimeSlicedWork = TimeSlicedScope.StartLoopScope();
+					if (TimeSlicedWork.IsOverBudget()) break;
+					Clock.AdvanceSeconds(0.0006);
+				}
+			}
+			{
+				FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, -1.0, 2);
+				for (int32 Index = 0; Index < TestArray.Num(); ++Index)
+				{
+					FGWBTimeSlicedLoopScope TimeSlicedWork = TimeSlicedScope.StartLoopScope();
+					if (TimeSlicedWork.IsOverBudget()) break;
+				}
+			}
+
+			const FGWBTimeSlicerTelemetry& Telemetry = TimeSlicer->GetTelemetry();
+			TestTrue("Every scope should count as a cycle", Telemetry.GetNumCycles() == 3);
+			TestTrue("Both time budgeted cycles should be over the frame budget", Telemetry.GetNumFrameBudgetExceeded() == 2);
+			TestTrue("The count budgeted cycle should be over the count budget", Telemetry.GetNumWorkUnitCountBudgetExceeded() == 1);
+		});
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -19,18 +19,47 @@ void UGWBLoopUtilsTestHelper::ProcessWorkUnit(FBudgetedLoopHandle& LoopHandle)
 	}
 	
 	// Add sleep if specified
-	if (SleepDuration > 0.0f)
+	if (SleepDuration > 0.0f && VirtualClock)
+	{
+		VirtualClock->AdvanceSeconds(SleepDuration);
+	}
+	else if (SleepDuration > 0.0f)
 	{
 		FPlatformProcess::Sleep(SleepDuration);
 	}
 }
 
+void UGWBLoopUtilsTestHelper::ProcessLatentLoopBody(int32 Index)
+{
+	ProcessedCount++;
+	LatentIndices.Add(Index);
+	if (LatentAction && BreakAtCount > 0 && ProcessedCount >= BreakAtCount)
+	{
+		LatentAction->Break();
+	}
+}
+
+void UGWBLoopUtilsTestHelper::OnLatentLoopCompleted(int32 Index)
+{
+	LatentCompletedIndex = Index;
+}
+
+void UGWBLoopUtilsTestHelper::OnLatentLoopBroken(int32 Index)
+{
+	LatentBrokenIndex = Index;
+}
+
 void UGWBLoopUtilsTestHelper::ResetCounter()
 {
 	ProcessedCount = 0;
+	LatentIndices.Reset();
+	LatentCompletedIndex = INDEX_NONE;
+	LatentBrokenIndex = INDEX_NONE;
+	LatentAction = nullptr;
 	bShouldBreak = false;
 	BreakAtCount = -1;
 	SleepDuration = 0.0f;
+	VirtualClock = nullptr;
 	CustomCallback = nullptr;
 }
 
@@ -44,6 +73,11 @@ void UGWBLoopUtilsTestHelper::SetSleepDuration(float Duration)
 	SleepDuration = Duration;
 }
 
+void UGWBLoopUtilsTestHelper::SetVirtualClock(FGWBVirtualClock* Clock)
+{
+	VirtualClock = Clock;
+}
+
 void UGWBLoopUtilsTestHelper::SetCustomCallback(TFunction<void(FBudgetedLoopHandle&)> Callback)
 {
 	CustomCallback = Callback;
@@ -0,0 +1,96 @@
+#include "Utils/GWBBudgetedForLoopAction.h"
+#include "Components/GWBTimeSlicer.h"
+#include "DataTypes/GWBTimeSlicedScope.h"
+#include "Utils/GWBLoopUtils.h"
+#include "Engine/World.h"
+
+UGWBBudgetedForLoopAction* UGWBBudgetedForLoopAction::BudgetedForLoopLatent(UObject* WorldContextObject, float FrameBudget, int32 MaxWorkCount, int32 ArrayCount)
+{
+    UGWBBudgetedForLoopAction* Action = NewObject<UGWBBudgetedForLoopAction>();
+    Action->WorldContext = WorldContextObject;
+    Action->FrameBudget = FrameBudget;
+    Action->MaxWorkCount = FMath::Max(MaxWorkCount, 0);
+    Action->ArrayCount = FMath::Max(ArrayCount, 0);
+
+    // every loop gets its own slicer (and with it its own cursor), it isn't shared with any call site so it isn't registered
+    Action->TimeSlicer = NewObject<UGWBTimeSlicer>(Action);
+    Action->TimeSlicer->Init(FName(TEXT("BudgetedLoop_Latent")));
+
+    // keeps the action alive while the loop runs
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void UGWBBudgetedForLoopAction::Activate()
+{
+    if (RunFrame())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGWBBudgetedForLoopAction::RunFrame));
+    }
+}
+
+bool UGWBBudgetedForLoopAction::RunFrame(float DeltaTime)
+{
+    if (bFinished) return false;
+
+    // a loop without a context or budget can't run, same as the synchronous loop returning right away
+    if (!WorldContext.IsValid() || FrameBudget <= 0.f)
+    {
+        SetReadyToDestroy();
+        return false;
+    }
+
+    // the core ticker keeps ticking while the game is paused, the loop waits for its world to be unpaused instead
+    const UWorld* World = WorldContext->GetWorld();
+    if (World && World->IsPaused())
+    {
+        return true;
+    }
+
+    // a break requested between ticks ends the loop on the last element it did, without doing another one
+    if (bBreakRequested)
+    {
+        Broken.Broadcast(LastIndex);
+        SetReadyToDestroy();
+        return false;
+    }
+
+    FGWBTimeSlicedScope TimeSlicedScope(TimeSlicer, FrameBudget, MaxWorkCount);
+    const FGWBBudgetedLoopResult Result = GWBLoopUtils::RunBudgetedLoop(TimeSlicedScope, GWBLoopUtils::Private::FCountLoopRange(this, ArrayCount), [this](FBudgetedLoopHandle& LoopHandle)
+    {
+        LastIndex = LoopHandle.GetIndex();
+        LoopBody.Broadcast(LastIndex);
+        if (bBreakRequested)
+        {
+            // the break state lives in the action, the global Blueprint break states aren't needed
+            LoopHandle.BreakWithoutBlueprintState();
+        }
+    });
+
+    if (Result.bBroken)
+    {
+        Broken.Broadcast(LastIndex);
+    }
+    else if (Result.bCompleted)
+    {
+        Completed.Broadcast(ArrayCount);
+    }
+    else
+    {
+        return true;
+    }
+
+    SetReadyToDestroy();
+    return false;
+}
+
+void UGWBBudgetedForLoopAction::SetReadyToDestroy()
+{
+    bFinished = true;
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+    Super::SetReadyToDestroy();
+}
@@ -0,0 +1,11 @@
+#include "Utils/GWBClock.h"
+
+IGWBClock* FGWBClock::Clock = nullptr;
+
+IGWBClock* FGWBClock::SetClock(IGWBClock* InClock)
+{
+	check(IsInGameThread());
+	IGWBClock* PreviousClock = Clock;
+	Clock = InClock;
+	return PreviousClock;
+}
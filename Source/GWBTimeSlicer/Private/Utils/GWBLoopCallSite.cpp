@@ -0,0 +1,41 @@
+#include "Utils/GWBLoopCallSite.h"
+#include "Components/GWBTimeSlicer.h"
+#include "GWBTimeSlicersSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+FGWBLoopCallSite::FGWBLoopCallSite(const uint32 Hash)
+    : Id(*FString::Printf(TEXT("BudgetedLoop_%u"), Hash))
+{
+}
+
+UGWBTimeSlicer* FGWBLoopCallSite::ResolveInContext(const UObject* WorldContext)
+{
+    // handles index a registry, one cached for another world's registry may resolve to another call site's slicer there
+    UGWBTimeSlicer* TimeSlicer = UGWBTimeSlicersSubsystem::GetTimeSlicer(WorldContext, Handle);
+    if (!TimeSlicer || TimeSlicer->GetId() != Id)
+    {
+        Handle = UGWBTimeSlicersSubsystem::GetTimeSlicerHandle(WorldContext, Id);
+        TimeSlicer = UGWBTimeSlicersSubsystem::GetTimeSlicer(WorldContext, Handle);
+    }
+
+    // the next calls from this world resolve the handle in its registry directly, contexts outside of a world always
+    // take this path since the engine wide registry is shared by all of them
+    const UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+    CachedWorld = World;
+    CachedSubsystem = World ? World->GetSubsystem<UGWBWorldTimeSlicersSubsystem>() : nullptr;
+    return TimeSlicer;
+}
+
+FGWBLoopCallSite& FGWBLoopCallSite::FindOrAdd(const uint32 Hash)
+{
+    check(IsInGameThread());
+    // boxed so the call sites don't move when the map grows, e.g. when a loop's work runs another loop for the first time
+    static TMap<uint32, TUniquePtr<FGWBLoopCallSite>> CallSites;
+    TUniquePtr<FGWBLoopCallSite>& CallSite = CallSites.FindOrAdd(Hash);
+    if (!CallSite)
+    {
+        CallSite = MakeUnique<FGWBLoopCallSite>(Hash);
+    }
+    return *CallSite;
+}
@@ -14,18 +14,21 @@ void FBudgetedLoopHandle::Break()
 
 bool FBudgetedLoopHandle::ShouldBreak() const
 {
-    // Check both C++ flag and Blueprint break states
-    return bShouldBreak || UGWBLoopUtilsBlueprintLibrary::BlueprintBreakStates.FindRef(HandleID);
+    // Check both C++ flag and Blueprint break states, the map is empty unless a loop is being broken
+    return bShouldBreak || (UGWBLoopUtilsBlueprintLibrary::BlueprintBreakStates.Num() > 0 && UGWBLoopUtilsBlueprintLibrary::BlueprintBreakStates.FindRef(HandleID));
 }
 
 void FBudgetedLoopHandle::Reset()
 {
     bShouldBreak = false;
-    // Clean up Blueprint break state
-    UGWBLoopUtilsBlueprintLibrary::BlueprintBreakStates.Remove(HandleID);
+    // Clean up Blueprint break state, the map is empty unless a loop is being broken
+    if (UGWBLoopUtilsBlueprintLibrary::BlueprintBreakStates.Num() > 0)
+    {
+        UGWBLoopUtilsBlueprintLibrary::BlueprintBreakStates.Remove(HandleID);
+    }
 }
 
-void UGWBLoopUtilsBlueprintLibrary::BudgetedForLoopBlueprint(
+FGWBBudgetedLoopResult UGWBLoopUtilsBlueprintLibrary::BudgetedForLoopBlueprint(
     const UObject* WorldContextObject,
     float FrameBudget,
     int32 MaxWorkCount,
@@ -36,7 +39,7 @@ void UGWBLoopUtilsBlueprintLibrary::BudgetedForLoopBlueprint(
     // Handle edge cases
     if (!WorldContextObject || ArrayCount <= 0 || FrameBudget <= 0.0f)
     {
-        return;
+        return FGWBBudgetedLoopResult();
     }
     
     // Generate a unique ID if none provided
@@ -72,26 +75,13 @@ void UGWBLoopUtilsBlueprintLibrary::BudgetedForLoopBlueprint(
     // Create the time-sliced reset scope
     FGWBTimeSlicedScope TimeSlicer(WorldContextObject, UniqueId, FrameBudget, MaxWorkCount);
     
-    // Create loop handle for break functionality
-    FBudgetedLoopHandle LoopHandle;
-    LoopHandle.Reset(); // Ensure clean state
-    
-    // Iterate through the array count
-    for (int32 Index = 0; Index < ArrayCount; ++Index)
+    // Iterate through the array count from where the previous call stopped, Blueprints only pass the count so the
+    // calling object stands in for the array's identity
+    return GWBLoopUtils::RunBudgetedLoop(TimeSlicer, WorldContextObject, ArrayCount, [&WorkDelegate](FBudgetedLoopHandle& LoopHandle)
     {
-        FGWBTimeSlicedLoopScope TimeSlicedWork = TimeSlicer.StartLoopScope();
-        // Check if we're over budget OR user requested break
-        if (TimeSlicedWork.IsOverBudget() || LoopHandle.ShouldBreak())
-        {
-            break;
-        }
-        
         // Execute the work delegate if bound, passing the loop handle
-        if (WorkDelegate.IsBound())
-        {
-            WorkDelegate.ExecuteIfBound(LoopHandle);
-        }
-    }
+        WorkDelegate.ExecuteIfBound(LoopHandle);
+    });
 }
 
 void UGWBLoopUtilsBlueprintLibrary::BreakBudgetedLoop(const FBudgetedLoopHandle& LoopHandle)
@@ -104,4 +94,9 @@ bool UGWBLoopUtilsBlueprintLibrary::IsBudgetedLoopBroken(const FBudgetedLoopHand
 {
     // Check if this handle has been broken via Blueprint or C++
     return LoopHandle.ShouldBreak();
+}
+
+int32 UGWBLoopUtilsBlueprintLibrary::GetBudgetedLoopIndex(const FBudgetedLoopHandle& LoopHandle)
+{
+    return LoopHandle.GetIndex();
 }
\ No newline at end of file
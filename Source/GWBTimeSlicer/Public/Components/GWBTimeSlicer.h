@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "DataTypes/GWBLoopCursor.h"
+#include "DataTypes/GWBTimeSlicerHandle.h"
+#include "DataTypes/GWBTimeSlicerTelemetry.h"
+#include "Utils/GWBClock.h"
 #include "GWBTimeSlicer.generated.h"
 
 /**
@@ -20,29 +24,52 @@ class GWBTIMESLICER_API UGWBTimeSlicer : public UObject
 	
 public:
 
-	void Init();
+	void Init(FName InId);
 
 	/**
-	 * @brief get global singleton slicer by Id
+	 * @brief get the slicer by Id, shared by all contexts of the same world (or by all contexts outside of a world)
 	 * @param Id 
-	 * @return global time slicer for the provided Id
+	 * @return time slicer for the provided Id
 	 */
 	UFUNCTION()
 	static UGWBTimeSlicer* Get(const UObject* WorldContextObject, FName Id);
 
+	/**
+	 * @brief get the handle of the slicer by Id (see `Get`), creating the slicer if needed. Look the handle up once
+	 * (e.g. when your system initializes) and use `Resolve` with the same context from then on.
+	 * @param Id 
+	 * @return handle of the time slicer for the provided Id
+	 */
+	static FGWBTimeSlicerHandle GetHandle(const UObject* WorldContextObject, FName Id);
+
+	/**
+	 * @brief get the slicer by handle, an array access instead of a lookup by name. If the slicer has been evicted for
+	 * being idle (see `gwb.timeslicer.maxidleframes`) it's looked up by name again, creating a new one.
+	 * @param Handle 
+	 * @return time slicer for the provided handle, nullptr if the handle is invalid
+	 */
+	static UGWBTimeSlicer* Resolve(const UObject* WorldContextObject, FGWBTimeSlicerHandle Handle);
+
 	// <api>
 	void Reset();
 	void StartWork();
 	void EndWork();
-	bool HasBudgetBeenExceeded() const;
-	bool HasFrameBudgetBeenExceeded() const;
-	bool HasWorkUnitCountBudgetBeenExceeded() const;
+	/** Same as above with the current time (from `FGWBClock::Cycles()`) the caller already read, e.g. to time its own work. */
+	void StartWork(uint64 NowCycles);
+	void EndWork(uint64 NowCycles);
+	FORCEINLINE bool HasBudgetBeenExceeded() const { return HasWorkUnitCountBudgetBeenExceeded() || HasFrameBudgetBeenExceeded(); }
+	FORCEINLINE bool HasBudgetBeenExceeded(uint64 NowCycles) const { return HasWorkUnitCountBudgetBeenExceeded() || HasFrameBudgetBeenExceeded(NowCycles); }
+	FORCEINLINE bool HasFrameBudgetBeenExceeded() const { return HasFrameBudgetBeenExceeded(FGWBClock::Cycles()); }
+	FORCEINLINE bool HasFrameBudgetBeenExceeded(uint64 NowCycles) const { return NowCycles >= FrameBudgetExceededCycles; }
+	FORCEINLINE bool HasWorkUnitCountBudgetBeenExceeded() const { return WorkUnitCountBudget > 0 && CycleWorkUnitsCompleted >= static_cast<uint32>(WorkUnitCountBudget); }
 	float GetRemainingTimeInBudget() const;
 	double GetFrameBudgetExceededTimestamp() const;
 	uint32 GetRemainingWorkUnitCountBudget() const;
 	FORCEINLINE uint32 GetCycleWorkUnitsCompleted() const { return CycleWorkUnitsCompleted; };
-	FORCEINLINE double GetCycleLastTimestamp() const { return CycleLastTimestamp; };
-	FORCEINLINE double GetLastResetTimestamp() const { return LastResetTimestamp; };
+	FORCEINLINE double GetCycleLastTimestamp() const { return FGWBClock::ToSeconds(CycleLastCycles); };
+	FORCEINLINE double GetLastResetTimestamp() const { return FGWBClock::ToSeconds(LastResetCycles); };
+	FORCEINLINE uint64 GetCycleLastCycles() const { return CycleLastCycles; };
+	FORCEINLINE uint64 GetLastResetCycles() const { return LastResetCycles; };
 	// </api>
 
 	// <builder-methods>
@@ -51,6 +78,20 @@ public:
 	// </builder-methods>
 
 	// <getters>
+	FName GetId() const { return Id; }
+	uint64 GetLastUsedFrame() const { return LastUsedFrame; }
+	const FGWBTimeSlicerTelemetry& GetTelemetry() const { return Telemetry; }
+	void ResetTelemetry() { Telemetry.Reset(); }
+	/** @returns where the call site's budgeted loop over the container with the identity left off, each container has its own cursor. */
+	FORCEINLINE FGWBLoopCursor& GetLoopCursor(const void* LoopIdentity)
+	{
+		FGWBLoopCursor* LoopCursor = LoopCursors.Find(LoopIdentity);
+		if (!LoopCursor) LoopCursor = &AddLoopCursor(LoopIdentity);
+		LoopCursor->LastUsedFrame = GFrameCounter;
+		return *LoopCursor;
+	}
+	void ResetLoopCursors() { LoopCursors.Reset(); }
+	int32 GetNumLoopCursors() const { return LoopCursors.Num(); }
 	double GetFrameTimeBudget() const { return FrameTimeBudget; }
 	double GetWorkUnitCountBudget() const { return WorkUnitCountBudget; }
 	// </getters>
@@ -58,20 +99,25 @@ public:
 private:
 
 	// <config>
+	FName Id;
 	double FrameTimeBudget; // this is a value in seconds
 	int32 WorkUnitCountBudget; // how many units we're allowed to do (-1 means infinite)
 	// </config>
 
 	// <state>
 	uint32 CycleWorkUnitsCompleted = 0;
-	double CycleLastTimestamp; // this is a specific point in platform time
-	double LastResetTimestamp; // specific point in time the slicer has been reset to 0 so we have full budget
+	uint64 CycleLastCycles; // this is a specific point in time (see `FGWBClock`)
+	uint64 LastResetCycles; // specific point in time the slicer has been reset to 0 so we have full budget
+	uint64 FrameBudgetExceededCycles; // LastResetCycles + FrameTimeBudget, precomputed so budget checks are a single compare
+	uint64 LastUsedFrame = 0; // frame the slicer was last reset, idle slicers are evicted from their registry (see `FGWBTimeSlicerRegistry`)
+	TMap<const void*, FGWBLoopCursor> LoopCursors; // where the budgeted loop of the call site this slicer is for left off, per looped over container
+	uint64 LastLoopCursorEvictionFrame = 0; // cursors unused for `gwb.timeslicer.maxidleframes` frames are dropped when a new one is added
+	FGWBLoopCursor& AddLoopCursor(const void* LoopIdentity);
+	void UpdateFrameBudgetExceededCycles();
 	// </state>
 
 	// <telemetry>
-	double UnitWorkAverageDuration;
-	uint32 WorkUnitsRecorded;
-	TCircularBuffer<double> UnitWorkDurations{5};
-	void RecordTelemetry(const double WorkDuration);
+	FGWBTimeSlicerTelemetry Telemetry;
+	bool bCycleFrameBudgetExceeded = false; // a unit of work of the current cycle ended past the frame budget
 	// </telemetry>
 };
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Where a budgeted loop left off, kept by the time slicer of its call site (one per looped over container) so the loop
+ * resumes from there next frame instead of starting over (see `GWBLoopUtils::BudgetedForLoop`). The cursor starts over
+ * when its container was resized.
+ */
+struct FGWBLoopCursor
+{
+	/**
+	 * Points the cursor at a loop over `InNum` elements of its container.
+	 * @returns true if the previous pass over the same loop completed, so this one starts over from the first element.
+	 */
+	FORCEINLINE bool Begin(int32 InNum)
+	{
+		if (Num != InNum)
+		{
+			Num = InNum;
+			Restart();
+		}
+		const bool bWrappedAround = bCompletedPass;
+		bCompletedPass = false;
+		return bWrappedAround;
+	}
+
+	/** The last element was done, the next pass starts from the first element. */
+	FORCEINLINE void Complete() { Index = 0; bCompletedPass = true; }
+
+	/** Start over from the first element, e.g. because the loop was broken. */
+	FORCEINLINE void Restart() { Index = 0; bCompletedPass = false; }
+
+	/** Index of the next element to do. */
+	int32 Index = 0;
+
+	/** Frame the cursor was last used, cursors of containers that are no longer looped over are dropped by their slicer. */
+	uint64 LastUsedFrame = 0;
+
+private:
+	int32 Num = 0;
+	bool bCompletedPass = false;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/GWBClock.h"
+
+/**
+ * A plain value type time slicer for budgets that never outlive a single scope, e.g. the budget of one pass over a
+ * loop. It has the same budget semantics as `UGWBTimeSlicer` but isn't registered anywhere or garbage collected, so
+ * checking and using up the budget are a handful of inlined instructions instead of a lookup and a pointer chase.
+ *
+ * EXAMPLE:
+ * ```
+ * FGWBStackTimeSlicer TimeSlicer(FrameBudget, MaxCountAllowedPerFrame);
+ * for (auto Overlap : MyOverlapsToProcess)
+ * {
+ *   if (TimeSlicer.HasBudgetBeenExceeded()) break;
+ *   TimeSlicer.StartWork();
+ *   DoSomeExpensiveProcessing(Overlap);
+ *   TimeSlicer.EndWork();
+ * }
+ * ```
+ * Use a `UGWBTimeSlicer` (through `FGWBTimeSlicedScope`) instead when the budget has to be shared across functions.
+ */
+struct FGWBStackTimeSlicer
+{
+	/** Starts with a full budget: a negative time budget or a count budget <= 0 means no limit. */
+	FGWBStackTimeSlicer(double FrameTimeBudgetIn, int32 WorkUnitCountBudgetIn)
+		: FrameTimeBudget(FrameTimeBudgetIn)
+		, WorkUnitCountBudget(WorkUnitCountBudgetIn)
+	{
+		Reset();
+	}
+
+	// <api>
+	FORCEINLINE void Reset()
+	{
+		CycleWorkUnitsCompleted = 0;
+		CycleLastCycles = 0;
+		LastResetCycles = FGWBClock::Cycles();
+		// a negative budget is unlimited, so it's never exceeded
+		FrameBudgetExceededCycles = FrameTimeBudget >= 0 ? LastResetCycles + FGWBClock::ToCycles(FrameTimeBudget) : MAX_uint64;
+	}
+	FORCEINLINE void StartWork() { StartWork(FGWBClock::Cycles()); }
+	FORCEINLINE void StartWork(uint64 NowCycles) { CycleLastCycles = NowCycles; }
+	FORCEINLINE void EndWork() { CycleWorkUnitsCompleted++; }
+	FORCEINLINE bool HasBudgetBeenExceeded() const { return HasBudgetBeenExceeded(FGWBClock::Cycles()); }
+	FORCEINLINE bool HasBudgetBeenExceeded(uint64 NowCycles) const { return HasWorkUnitCountBudgetBeenExceeded() || HasFrameBudgetBeenExceeded(NowCycles); }
+	FORCEINLINE bool HasFrameBudgetBeenExceeded() const { return HasFrameBudgetBeenExceeded(FGWBClock::Cycles()); }
+	FORCEINLINE bool HasFrameBudgetBeenExceeded(uint64 NowCycles) const { return NowCycles >= FrameBudgetExceededCycles; }
+	FORCEINLINE bool HasWorkUnitCountBudgetBeenExceeded() const { return WorkUnitCountBudget > 0 && CycleWorkUnitsCompleted >= WorkUnitCountBudget; }
+	FORCEINLINE double GetRemainingTimeInBudget() const { return FrameTimeBudget - FGWBClock::ToSeconds(FGWBClock::Cycles() - LastResetCycles); }
+	FORCEINLINE double GetFrameBudgetExceededTimestamp() const { return GetLastResetTimestamp() + FrameTimeBudget; }
+	FORCEINLINE int32 GetRemainingWorkUnitCountBudget() const { return WorkUnitCountBudget - CycleWorkUnitsCompleted; }
+	FORCEINLINE int32 GetCycleWorkUnitsCompleted() const { return CycleWorkUnitsCompleted; }
+	FORCEINLINE double GetCycleLastTimestamp() const { return FGWBClock::ToSeconds(CycleLastCycles); }
+	FORCEINLINE double GetLastResetTimestamp() const { return FGWBClock::ToSeconds(LastResetCycles); }
+	// </api>
+
+	// <getters>
+	FORCEINLINE double GetFrameTimeBudget() const { return FrameTimeBudget; }
+	FORCEINLINE int32 GetWorkUnitCountBudget() const { return WorkUnitCountBudget; }
+	// </getters>
+
+private:
+
+	// <config>
+	double FrameTimeBudget; // this is a value in seconds
+	int32 WorkUnitCountBudget; // how many units we're allowed to do (<= 0 means infinite)
+	// </config>
+
+	// <state>
+	int32 CycleWorkUnitsCompleted;
+	uint64 CycleLastCycles; // this is a specific point in time (see `FGWBClock`)
+	uint64 LastResetCycles; // specific point in time the slicer has been reset to 0 so we have full budget
+	uint64 FrameBudgetExceededCycles; // LastResetCycles + FrameTimeBudget, precomputed so budget checks are a single compare
+	// </state>
+};
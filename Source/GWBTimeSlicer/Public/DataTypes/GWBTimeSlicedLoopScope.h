@@ -57,48 +57,78 @@ struct GWBTIMESLICER_API FGWBTimeSlicedLoopScope
 	
 	FGWBTimeSlicedLoopScope()
 			: Id(NAME_None)
-			,WorldContextObject(nullptr)
+			,GlobalTimeSlicer(nullptr)
 	{
 	}
 
 	FGWBTimeSlicedLoopScope(const UObject* WorldContext, FName Id)
-			: Id(Id)
-			,WorldContextObject(WorldContext)
+			: FGWBTimeSlicedLoopScope(UGWBTimeSlicer::Get(WorldContext, Id))
 	{
-		GlobalTimeSlicer = UGWBTimeSlicer::Get(WorldContext, Id);
-		ensureAlwaysMsgf(GlobalTimeSlicer->GetFrameTimeBudget() > 0.f, TEXT("FGWBTimeSlicedLoopScope -> attempting to start time slicer %s with no budget"), *Id.ToString());
-		GlobalTimeSlicer.Get()
-			->StartWork();
 	}
 
 	FGWBTimeSlicedLoopScope(const UObject* WorldContext, FName Id, double FrameTimeBudgetIn, uint32 WorkCountBudgetIn)
-			: Id(Id)
-			,WorldContextObject(WorldContext)
+			: FGWBTimeSlicedLoopScope(UGWBTimeSlicer::Get(WorldContext, Id), FrameTimeBudgetIn, WorkCountBudgetIn)
+	{
+	}
+
+	/** Use an already resolved slicer (see `UGWBTimeSlicer::GetHandle`) so hot loops don't look it up for every iteration. */
+	explicit FGWBTimeSlicedLoopScope(UGWBTimeSlicer* TimeSlicer)
+			: Id(TimeSlicer->GetId())
+			,GlobalTimeSlicer(TimeSlicer)
+	{
+		ensureAlwaysMsgf(GlobalTimeSlicer->GetFrameTimeBudget() > 0.f, TEXT("FGWBTimeSlicedLoopScope -> attempting to start time slicer %s with no budget"), *Id.ToString());
+		GlobalTimeSlicer->StartWork();
+	}
+
+	FGWBTimeSlicedLoopScope(UGWBTimeSlicer* TimeSlicer, double FrameTimeBudgetIn, uint32 WorkCountBudgetIn)
+			: FGWBTimeSlicedLoopScope(TimeSlicer, FrameTimeBudgetIn, WorkCountBudgetIn, FGWBClock::Cycles())
+	{
+	}
+
+	/** Starts the work at a time (from `FGWBClock::Cycles()`) the caller already read, e.g. to check its own budgets with it. */
+	FGWBTimeSlicedLoopScope(UGWBTimeSlicer* TimeSlicer, double FrameTimeBudgetIn, uint32 WorkCountBudgetIn, uint64 NowCycles)
+			: Id(TimeSlicer->GetId())
+			,GlobalTimeSlicer(TimeSlicer)
 	{
-		GlobalTimeSlicer = UGWBTimeSlicer::Get(WorldContext, Id);
-		GlobalTimeSlicer.Get()
+		GlobalTimeSlicer
 			->ConfigureTimeBudget(FrameTimeBudgetIn)
 			->ConfigureWorkUnitCountBudget(WorkCountBudgetIn)
-			->StartWork();
+			->StartWork(NowCycles);
 	}
 
 	~FGWBTimeSlicedLoopScope()
 	{
-		GlobalTimeSlicer.Get()->EndWork();
+		if (GlobalTimeSlicer && !bHasEndedWork)
+		{
+			GlobalTimeSlicer->EndWork();
+		}
+	}
+
+	/** Ends the work before the scope does, at a time the caller already read (e.g. to time its own work). */
+	void EndWork(uint64 NowCycles)
+	{
+		if (!bHasEndedWork)
+		{
+			GlobalTimeSlicer->EndWork(NowCycles);
+			bHasEndedWork = true;
+		}
 	}
 
 	/** Time Slicer Identifier. */
 	FName Id;
 
-	bool IsOverBudget() const { return GlobalTimeSlicer.Get()->HasBudgetBeenExceeded(); }
-	bool IsOverFrameTimeBudget() const { return GlobalTimeSlicer.Get()->HasFrameBudgetBeenExceeded(); }
-	bool IsOverUnitCountBudget() const { return GlobalTimeSlicer.Get()->HasWorkUnitCountBudgetBeenExceeded(); }
-	double GetRemainingTimeInBudget() const { return UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)->GetRemainingTimeInBudget(); }
+	bool IsOverBudget() const { return GlobalTimeSlicer->HasBudgetBeenExceeded(); }
+	bool IsOverBudget(uint64 NowCycles) const { return GlobalTimeSlicer->HasBudgetBeenExceeded(NowCycles); }
+	bool IsOverFrameTimeBudget() const { return GlobalTimeSlicer->HasFrameBudgetBeenExceeded(); }
+	bool IsOverFrameTimeBudget(uint64 NowCycles) const { return GlobalTimeSlicer->HasFrameBudgetBeenExceeded(NowCycles); }
+	bool IsOverUnitCountBudget() const { return GlobalTimeSlicer->HasWorkUnitCountBudgetBeenExceeded(); }
+	double GetRemainingTimeInBudget() const { return GlobalTimeSlicer->GetRemainingTimeInBudget(); }
 
-	TWeakObjectPtr<UGWBTimeSlicer> GetTimeSlicer() const { return GlobalTimeSlicer; };
+	UGWBTimeSlicer* GetTimeSlicer() const { return GlobalTimeSlicer; };
 	
 private:
 	
-	TWeakObjectPtr<const UObject> WorldContextObject;
-	TWeakObjectPtr<UGWBTimeSlicer> GlobalTimeSlicer;
+	/** Slicers stay in their registry while they're used (this scope resets it) and this scope only lives on the stack. */
+	UGWBTimeSlicer* GlobalTimeSlicer;
+	bool bHasEndedWork = false;
 };
@@ -18,23 +18,33 @@ struct GWBTIMESLICER_API FGWBTimeSlicedScope
 	
 	FGWBTimeSlicedScope()
 			: Id(NAME_None)
-			,WorldContextObject(nullptr)
+			,TimeSlicer(nullptr)
 	{
 	}
 
 	FGWBTimeSlicedScope(const UObject* WorldContext, const FName Id)
-			: Id(Id)
-			,WorldContextObject(WorldContext)
+			: FGWBTimeSlicedScope(UGWBTimeSlicer::Get(WorldContext, Id))
 	{
-		UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)
-			->Reset();	
 	}
 
 	FGWBTimeSlicedScope(const UObject* WorldContext, const FName Id, double FrameTimeBudgetIn, uint32 WorkCountBudgetIn)
-			: Id(Id)
-			,WorldContextObject(WorldContext)
+			: FGWBTimeSlicedScope(UGWBTimeSlicer::Get(WorldContext, Id), FrameTimeBudgetIn, WorkCountBudgetIn)
+	{
+	}
+
+	/** Use an already resolved slicer (see `UGWBTimeSlicer::GetHandle`), the loop scopes it starts share it without any lookup. */
+	explicit FGWBTimeSlicedScope(UGWBTimeSlicer* TimeSlicerIn)
+			: Id(TimeSlicerIn->GetId())
+			,TimeSlicer(TimeSlicerIn)
+	{
+		TimeSlicer->Reset();
+	}
+
+	FGWBTimeSlicedScope(UGWBTimeSlicer* TimeSlicerIn, double FrameTimeBudgetIn, uint32 WorkCountBudgetIn)
+			: Id(TimeSlicerIn->GetId())
+			,TimeSlicer(TimeSlicerIn)
 	{
-		UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)
+		TimeSlicer
 			->ConfigureTimeBudget(FrameTimeBudgetIn)
 			->ConfigureWorkUnitCountBudget(WorkCountBudgetIn)
 			->Reset();	
@@ -42,31 +52,33 @@ struct GWBTIMESLICER_API FGWBTimeSlicedScope
 
 	~FGWBTimeSlicedScope()
 	{
-		if (WorldContextObject.IsValid())
+		if (TimeSlicer)
 		{
-			UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)->Reset();	
+			TimeSlicer->Reset();	
 		}
 	}
 
 	/** Time Slicer Identifier. */
 	FName Id;
 
-	bool IsOverBudget() const { return UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)->HasBudgetBeenExceeded(); }
-	double GetRemainingTimeInBudget() const { return UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)->GetRemainingTimeInBudget(); }
-	uint32 GetWorkUnitsCompleted() const { return UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)->GetCycleWorkUnitsCompleted(); }
-	double GetLastCycleTimestamp() const { return UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)->GetCycleLastTimestamp(); }
-	double GetLastResetTimestamp() const { return UGWBTimeSlicer::Get(WorldContextObject.Get(), Id)->GetLastResetTimestamp(); }
+	bool IsOverBudget() const { return TimeSlicer->HasBudgetBeenExceeded(); }
+	double GetRemainingTimeInBudget() const { return TimeSlicer->GetRemainingTimeInBudget(); }
+	uint32 GetWorkUnitsCompleted() const { return TimeSlicer->GetCycleWorkUnitsCompleted(); }
+	double GetLastCycleTimestamp() const { return TimeSlicer->GetCycleLastTimestamp(); }
+	double GetLastResetTimestamp() const { return TimeSlicer->GetLastResetTimestamp(); }
+	UGWBTimeSlicer* GetTimeSlicer() const { return TimeSlicer; }
 
 	FGWBTimeSlicedLoopScope StartLoopScope() const
 	{
-		return FGWBTimeSlicedLoopScope(WorldContextObject.Get(), Id);
+		return FGWBTimeSlicedLoopScope(TimeSlicer);
 	}
 	FGWBTimeSlicedLoopScope StartLoopScopeWithCustomBudget(double FrameTimeBudgetIn, uint32 WorkCountBudgetIn) const
 	{
-		return FGWBTimeSlicedLoopScope(WorldContextObject.Get(), Id, FrameTimeBudgetIn, WorkCountBudgetIn);
+		return FGWBTimeSlicedLoopScope(TimeSlicer, FrameTimeBudgetIn, WorkCountBudgetIn);
 	}
 
 private:
 	
-	TWeakObjectPtr<const UObject> WorldContextObject;
+	/** Slicers stay in their registry while they're used (this scope resets it) and this scope only lives on the stack. */
+	UGWBTimeSlicer* TimeSlicer;
 };
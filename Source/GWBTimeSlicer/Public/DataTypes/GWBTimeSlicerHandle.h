@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Stable index of a time slicer in a `FGWBTimeSlicerRegistry`. Resolve it once per call site (or cache the slicer it
+ * resolves to) instead of looking the slicer up by name every time it's used.
+ * The serial number tells the slicer apart from later slicers reusing its slot once it has been evicted for being idle,
+ * the identifier lets `UGWBTimeSlicer::Resolve` find (or create) the slicer by name again after that happened.
+ */
+struct FGWBTimeSlicerHandle
+{
+	FGWBTimeSlicerHandle() = default;
+	FGWBTimeSlicerHandle(int32 InIndex, uint32 InSerialNumber, FName InId) : Index(InIndex), SerialNumber(InSerialNumber), Id(InId) {}
+
+	FORCEINLINE bool IsValid() const { return Index != INDEX_NONE; }
+	FORCEINLINE int32 GetIndex() const { return Index; }
+	FORCEINLINE uint32 GetSerialNumber() const { return SerialNumber; }
+	FORCEINLINE FName GetId() const { return Id; }
+
+	FORCEINLINE bool operator==(const FGWBTimeSlicerHandle& Other) const { return Index == Other.Index && SerialNumber == Other.SerialNumber; }
+	FORCEINLINE bool operator!=(const FGWBTimeSlicerHandle& Other) const { return !(*this == Other); }
+
+private:
+	int32 Index = INDEX_NONE;
+	uint32 SerialNumber = 0;
+	FName Id;
+};
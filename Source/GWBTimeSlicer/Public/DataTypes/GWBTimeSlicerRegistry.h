@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DataTypes/GWBTimeSlicerHandle.h"
+#include "GWBTimeSlicerRegistry.generated.h"
+
+class UGWBTimeSlicer;
+
+/**
+ * Time slicers indexed by identifier and by handle. A slicer that hasn't been used (reset) for a while is evicted so
+ * call sites that come and go (e.g. a Budgeted For Loop per spawned actor) don't pile up slicers over a long session.
+ * See `UGWBTimeSlicersSubsystem` and `UGWBWorldTimeSlicersSubsystem` for the registries in use.
+ */
+USTRUCT()
+struct GWBTIMESLICER_API FGWBTimeSlicerRegistry
+{
+	GENERATED_BODY()
+
+	/** Get or create a time slicer for the identifier and return its handle, the handle stays valid until the slicer is evicted. */
+	FGWBTimeSlicerHandle GetTimeSlicerHandle(UObject* Outer, const FName& Id);
+
+	/** Resolve a handle without any lookup. @returns nullptr for handles of evicted slicers or of another registry. */
+	FORCEINLINE UGWBTimeSlicer* GetTimeSlicer(const FGWBTimeSlicerHandle Handle) const
+	{
+		const int32 Index = Handle.GetIndex();
+		return TimeSlicers.IsValidIndex(Index) && SerialNumbers[Index] == Handle.GetSerialNumber() ? TimeSlicers[Index] : nullptr;
+	}
+
+	/**
+	 * Drops the slicers that haven't been used for more than `MaxIdleFrames` frames (<= 0 keeps them all), handles to them
+	 * stop resolving and their identifiers get new slicers when they're used again. @returns the number of evicted slicers.
+	 */
+	int32 EvictIdleTimeSlicers(uint64 FrameCounter, int32 MaxIdleFrames);
+
+	/** Drops all slicers. */
+	void Empty();
+
+	/** Calls the function for every slicer in the registry. */
+	void ForEachTimeSlicer(TFunctionRef<void(UGWBTimeSlicer&)> Function) const;
+
+	/** @returns the number of slicers in the registry. */
+	FORCEINLINE int32 Num() const { return TimeSlicerIndices.Num(); }
+
+	/** @returns the number of frames a slicer may go unused before it's evicted (`gwb.timeslicer.maxidleframes`). */
+	static int32 GetMaxIdleFrames();
+
+private:
+
+	/** Slicers indexed by their handles, nullptr for slots freed by eviction. */
+	UPROPERTY()
+	TArray<UGWBTimeSlicer*> TimeSlicers;
+
+	/** Serial number per slot of `TimeSlicers`, bumped when its slicer is evicted so old handles stop resolving. */
+	TArray<uint32> SerialNumbers;
+
+	/** Slots of `TimeSlicers` freed by eviction. */
+	TArray<int32> FreeIndices;
+
+	/** Index into `TimeSlicers` by identifier, only used to hand out handles. */
+	TMap<FName, int32> TimeSlicerIndices;
+
+	/** Frame the idle slicers were last evicted, creating slicers evicts the idle ones at most once every `MaxIdleFrames`. */
+	uint64 LastEvictionFrame = 0;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/GWBClock.h"
+
+/**
+ * Per unit work durations and budget usage of a time slicer, to see how close to its limits it runs.
+ *
+ * Durations go into a fixed-size streaming histogram of clock cycles with 4 buckets per power of two, so recording a
+ * duration is a couple of integer operations and percentiles are accurate to within 25% no matter how many durations
+ * were recorded. Next to it an exponentially weighted moving average follows the recent durations.
+ */
+struct GWBTIMESLICER_API FGWBTimeSlicerTelemetry
+{
+	/** Weight of a new duration in the moving average. */
+	static constexpr double AverageSmoothingFactor = 0.1;
+	static constexpr int32 NumSubBuckets = 4;
+	static constexpr int32 NumBuckets = 128; // covers durations up to 2^33 cycles, longer ones land in the last bucket
+
+	// <api>
+	FORCEINLINE void RecordWorkDuration(uint64 DurationCycles)
+	{
+		const double Duration = FGWBClock::ToSeconds(DurationCycles);
+		AverageDuration = NumWorkUnits > 0 ? AverageDuration + AverageSmoothingFactor * (Duration - AverageDuration) : Duration;
+		MaxDurationCycles = FMath::Max(MaxDurationCycles, DurationCycles);
+		Buckets[GetBucketIndex(DurationCycles)]++;
+		NumWorkUnits++;
+	}
+	FORCEINLINE void RecordCycle(bool bFrameBudgetExceeded, bool bWorkUnitCountBudgetExceeded)
+	{
+		NumCycles++;
+		NumFrameBudgetExceeded += bFrameBudgetExceeded ? 1 : 0;
+		NumWorkUnitCountBudgetExceeded += bWorkUnitCountBudgetExceeded ? 1 : 0;
+	}
+	void Reset();
+	// </api>
+
+	// <getters>
+	/** @returns the duration in seconds under which the given fraction (0..1) of the recorded units of work took, 0 if none were recorded. */
+	double GetPercentileDuration(double Percentile) const;
+	FORCEINLINE double GetAverageDuration() const { return AverageDuration; }
+	FORCEINLINE double GetMaxDuration() const { return FGWBClock::ToSeconds(MaxDurationCycles); }
+	FORCEINLINE uint64 GetNumWorkUnits() const { return NumWorkUnits; }
+	FORCEINLINE uint64 GetNumCycles() const { return NumCycles; }
+	FORCEINLINE uint64 GetNumFrameBudgetExceeded() const { return NumFrameBudgetExceeded; }
+	FORCEINLINE uint64 GetNumWorkUnitCountBudgetExceeded() const { return NumWorkUnitCountBudgetExceeded; }
+	// </getters>
+
+	/** @returns the bucket of the histogram durations of this many cycles are counted in. */
+	static FORCEINLINE int32 GetBucketIndex(uint64 DurationCycles)
+	{
+		// the first buckets hold a single value each, after that every power of two is split into NumSubBuckets
+		if (DurationCycles < NumSubBuckets) return static_cast<int32>(DurationCycles);
+		const uint32 Exponent = FMath::FloorLog2_64(DurationCycles);
+		const int32 SubBucket = static_cast<int32>(DurationCycles >> (Exponent - 2)) & (NumSubBuckets - 1);
+		return FMath::Min(static_cast<int32>(Exponent - 1) * NumSubBuckets + SubBucket, NumBuckets - 1);
+	}
+
+	/** @returns the first number of cycles past the durations counted in the bucket. */
+	static uint64 GetBucketUpperBound(int32 BucketIndex);
+
+private:
+
+	// <state>
+	double AverageDuration = 0.0; // exponentially weighted moving average in seconds
+	uint64 MaxDurationCycles = 0;
+	uint64 NumWorkUnits = 0;
+	uint64 NumCycles = 0; // resets of the slicer with work done since the previous one
+	uint64 NumFrameBudgetExceeded = 0; // cycles that ran over the frame time budget
+	uint64 NumWorkUnitCountBudgetExceeded = 0; // cycles that used up the work unit count budget
+	uint32 Buckets[NumBuckets] = {};
+	// </state>
+};
@@ -2,14 +2,17 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/EngineSubsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DataTypes/GWBTimeSlicerHandle.h"
+#include "DataTypes/GWBTimeSlicerRegistry.h"
 #include "GWBTimeSlicersSubsystem.generated.h"
 
 class UGWBTimeSlicer;
 
 /**
- * Subsystem responsible for managing a global collection of Time Slicers.
+ * Subsystem responsible for managing the engine wide collection of Time Slicers, used by contexts that aren't in a world.
  * This subsystem maintains a stateful list of time slicers so they can be used across frames
- * to balance work across frames and stack frames.
+ * to balance work across frames and stack frames. Slicers of contexts in a world live in `UGWBWorldTimeSlicersSubsystem`.
  */
 UCLASS()
 class GWBTIMESLICER_API UGWBTimeSlicersSubsystem : public UEngineSubsystem 
@@ -21,10 +24,54 @@ public:
 	virtual void Deinitialize() override;
 	// End USubsystem
 
-	/** Get or create a time slicer for the identifier. At the moment, the timeslicer lives forever once created (this should be improved somehow). */
+	/** Get or create a time slicer for the identifier in the subsystem of the context: the one of its world, or this one if it isn't in a world. */
+	static FGWBTimeSlicerHandle GetTimeSlicerHandle(const UObject* WorldContextObject, const FName& Id);
+
+	/** Resolve a handle in the subsystem of the context (see above). */
+	static UGWBTimeSlicer* GetTimeSlicer(const UObject* WorldContextObject, const FGWBTimeSlicerHandle Handle);
+
+	/** Get or create a time slicer for the identifier. Slicers that go unused for `gwb.timeslicer.maxidleframes` frames are evicted. */
 	UGWBTimeSlicer* GetTimeSlicer(const FName& Id);
+
+	/** Get or create a time slicer for the identifier and return its handle, the handle stays valid until the slicer is evicted. */
+	FGWBTimeSlicerHandle GetTimeSlicerHandle(const FName& Id);
+
+	/** Resolve a handle without any lookup. @returns nullptr for handles that don't belong to this subsystem. */
+	FORCEINLINE UGWBTimeSlicer* GetTimeSlicer(const FGWBTimeSlicerHandle Handle) const { return Registry.GetTimeSlicer(Handle); }
+
+	const FGWBTimeSlicerRegistry& GetRegistry() const { return Registry; }
 	
 private:
-	/** We keep a global stateful list of time slicers so we can use them across frames. */
-	UPROPERTY() TMap<FName, UGWBTimeSlicer*> TimeSlicers;
-};
\ No newline at end of file
+	/** We keep a global stateful list of time slicers so we can use them across frames, indexed by their handles. */
+	UPROPERTY()
+	FGWBTimeSlicerRegistry Registry;
+};
+
+/**
+ * Time Slicers of the contexts in a world. They're torn down with the world, so per actor slicers (e.g. of a
+ * Budgeted For Loop in Blueprint) never outlive the level they were used in.
+ */
+UCLASS()
+class GWBTIMESLICER_API UGWBWorldTimeSlicersSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	// Begin USubsystem
+	virtual void Deinitialize() override;
+	// End USubsystem
+
+	/** Get or create a time slicer for the identifier. Slicers that go unused for `gwb.timeslicer.maxidleframes` frames are evicted. */
+	UGWBTimeSlicer* GetTimeSlicer(const FName& Id);
+
+	/** Get or create a time slicer for the identifier and return its handle, the handle stays valid until the slicer is evicted. */
+	FGWBTimeSlicerHandle GetTimeSlicerHandle(const FName& Id);
+
+	/** Resolve a handle without any lookup. @returns nullptr for handles that don't belong to this subsystem. */
+	FORCEINLINE UGWBTimeSlicer* GetTimeSlicer(const FGWBTimeSlicerHandle Handle) const { return Registry.GetTimeSlicer(Handle); }
+
+	const FGWBTimeSlicerRegistry& GetRegistry() const { return Registry; }
+
+private:
+	UPROPERTY()
+	FGWBTimeSlicerRegistry Registry;
+};
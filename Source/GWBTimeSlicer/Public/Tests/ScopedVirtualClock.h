@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/GWBClock.h"
+
+/**
+ * Virtual clock that drives all time slicing while it's in scope, then puts the previous clock back when the object
+ * goes out of scope. Work callbacks advance it to simulate how long they take.
+ *
+ * EXAMPLE:
+ * ```
+ * FScopedVirtualClock Clock;
+ * Manager->ScheduleWork(WorkGroupID, Options).OnHandleWork([&Clock]() { Clock.AdvanceSeconds(0.1); });
+ * ```
+ */
+class FScopedVirtualClock : public FGWBVirtualClock
+{
+public:
+
+	/** Starts at the current time so timestamps taken before the clock was installed don't end up in the future. */
+	FScopedVirtualClock()
+		: FScopedVirtualClock(FGWBClock::Cycles())
+	{
+	}
+
+	explicit FScopedVirtualClock(uint64 InCycles)
+		: FGWBVirtualClock(InCycles)
+		, PreviousClock(FGWBClock::SetClock(this))
+	{
+	}
+
+	~FScopedVirtualClock()
+	{
+		FGWBClock::SetClock(PreviousClock);
+	}
+
+	// Deleted copy/move constructors and assignment operators
+	FScopedVirtualClock(FScopedVirtualClock&&) = delete;
+	FScopedVirtualClock(const FScopedVirtualClock&) = delete;
+	FScopedVirtualClock& operator=(FScopedVirtualClock&&) = delete;
+	FScopedVirtualClock& operator=(const FScopedVirtualClock&) = delete;
+
+private:
+
+	IGWBClock* PreviousClock;
+};
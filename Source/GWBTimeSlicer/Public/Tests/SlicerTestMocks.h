@@ -1,7 +1,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Utils/GWBBudgetedForLoopAction.h"
 #include "Utils/GWBLoopUtils.h"
+#include "Utils/GWBClock.h"
 
 #include "SlicerTestMocks.generated.h"
 
@@ -19,14 +21,29 @@ public:
 	bool bShouldBreak = false;
 	int32 BreakAtCount = -1;
 	float SleepDuration = 0.0f;
+	FGWBVirtualClock* VirtualClock = nullptr;
 	TFunction<void(FBudgetedLoopHandle&)> CustomCallback;
+	/** Indices the latent loop body was called with, and the indices its completed and broken pins fired with. */
+	TArray<int32> LatentIndices;
+	int32 LatentCompletedIndex = INDEX_NONE;
+	int32 LatentBrokenIndex = INDEX_NONE;
+	UPROPERTY()
+	UGWBBudgetedForLoopAction* LatentAction = nullptr;
 	
 	UFUNCTION()
 	void ProcessWorkUnit(FBudgetedLoopHandle& LoopHandle);
+	UFUNCTION()
+	void ProcessLatentLoopBody(int32 Index);
+	UFUNCTION()
+	void OnLatentLoopCompleted(int32 Index);
+	UFUNCTION()
+	void OnLatentLoopBroken(int32 Index);
 	
 	void ResetCounter();
 	void SetBreakAtCount(int32 Count);
 	void SetSleepDuration(float Duration);
+	/** Work advances this clock by the sleep duration instead of sleeping. */
+	void SetVirtualClock(FGWBVirtualClock* Clock);
 	void SetCustomCallback(TFunction<void(FBudgetedLoopHandle&)> Callback);
 };
 
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "GWBBudgetedForLoopAction.generated.h"
+
+class UGWBTimeSlicer;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGWBBudgetedForLoopActionDelegate, int32, Index);
+
+/**
+ * Latent Blueprint version of the Budgeted For Loop: iterates across frames on its own, doing as many iterations every
+ * tick as fit in the budgets, until the last one is done or the loop is broken. Unlike `BudgetedForLoopBlueprint` it
+ * doesn't need to be called again every tick, and its break state lives in the action instead of a global map. It
+ * doesn't iterate while the world of its context is paused.
+ *
+ * USAGE IN BLUEPRINTS:
+ * 1. Call "Budgeted For Loop (Latent)" once, e.g. on Begin Play
+ * 2. Connect your expensive processing logic to the Loop Body pin, the Index output is the element to process
+ * 3. Call "Break" on the Async Action output to exit early, the Broken pin then fires with the index of the last element
+ *    the loop body fired for (the one it was called on from within the loop body, INDEX_NONE if there was none yet)
+ * 4. Completed fires with the element count once the last element was processed
+ */
+UCLASS()
+class GWBTIMESLICER_API UGWBBudgetedForLoopAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+    friend class FGWBLoopUtilsTests;
+
+public:
+    /**
+     * Start a budgeted for loop that runs across frames.
+     * 
+     * @param WorldContextObject - Object providing world context, the loop stops when it goes away
+     * @param FrameBudget - Time budget in seconds per frame (e.g., 0.001 for 1ms)
+     * @param MaxWorkCount - Maximum number of iterations per frame, 0 for no limit
+     * @param ArrayCount - Number of elements to process (mimics array length)
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWB|Loop Utils",
+              meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject",
+                      DisplayName = "Budgeted For Loop (Latent)",
+                      ToolTip = "Distributes a loop across frames on its own, running as many iterations every tick as fit in the budgets."))
+    static UGWBBudgetedForLoopAction* BudgetedForLoopLatent(UObject* WorldContextObject, float FrameBudget, int32 MaxWorkCount, int32 ArrayCount);
+
+    /** Fires for every element with its index. */
+    UPROPERTY(BlueprintAssignable)
+    FGWBBudgetedForLoopActionDelegate LoopBody;
+
+    /** Fires with the element count once the last element was processed. */
+    UPROPERTY(BlueprintAssignable)
+    FGWBBudgetedForLoopActionDelegate Completed;
+
+    /** Fires with the index of the element the loop was broken on. */
+    UPROPERTY(BlueprintAssignable)
+    FGWBBudgetedForLoopActionDelegate Broken;
+
+    /** Break out of the loop, after the current iteration when called from Loop Body and before the next tick's otherwise. */
+    UFUNCTION(BlueprintCallable, Category = "GWB|Loop Utils")
+    void Break() { bBreakRequested = true; }
+
+    // Begin UBlueprintAsyncActionBase
+    virtual void Activate() override;
+    virtual void SetReadyToDestroy() override;
+    // End UBlueprintAsyncActionBase
+
+    FORCEINLINE bool IsRunning() const { return !bFinished; }
+
+protected:
+    /**
+     * Do this frame's iterations (called on activation, then every tick while the loop runs), none while the world is paused.
+     * @return true while there are iterations left for the next frames
+     */
+    bool RunFrame(float DeltaTime = 0.f);
+
+private:
+    UPROPERTY()
+    UGWBTimeSlicer* TimeSlicer = nullptr;
+
+    TWeakObjectPtr<UObject> WorldContext;
+    FTSTicker::FDelegateHandle TickerHandle;
+    float FrameBudget = 0.f;
+    int32 MaxWorkCount = 0;
+    int32 ArrayCount = 0;
+    int32 LastIndex = INDEX_NONE; // element the loop body last fired for, the one a break ends the loop on
+    bool bBreakRequested = false;
+    bool bFinished = false;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "HAL/PlatformTime.h"
+
+/**
+ * Source of time for `FGWBClock`. The platform counter is used unless another clock is installed with
+ * `FGWBClock::SetClock`, e.g. a `FGWBVirtualClock` so tests and benchmarks control exactly how much time passes.
+ */
+class IGWBClock
+{
+public:
+	virtual ~IGWBClock() = default;
+
+	/** @returns the current time in cycles of the platform counter (see `FPlatformTime::GetSecondsPerCycle64`). */
+	virtual uint64 GetCycles() const = 0;
+};
+
+/**
+ * Clock all the time slicing is measured with. Time is read as a raw `Cycles64` counter, which is cheaper than reading
+ * `FPlatformTime::Seconds()` since it skips the conversion to seconds: budgets are converted to cycles once (when they
+ * are configured or reset) so checking a budget is a counter read and an integer compare.
+ *
+ * Timestamps in seconds (`Seconds()`, `ToSeconds()`) share the same origin as the cycles, so they can only be compared
+ * with other timestamps from this clock, not with `FPlatformTime::Seconds()`.
+ *
+ * Game thread only: the installed clock is a plain global.
+ */
+struct GWBTIMESLICER_API FGWBClock
+{
+	/** @returns the current time in clock cycles. */
+	static FORCEINLINE uint64 Cycles() { return Clock ? Clock->GetCycles() : FPlatformTime::Cycles64(); }
+
+	/** @returns the current time in seconds. */
+	static FORCEINLINE double Seconds() { return ToSeconds(Cycles()); }
+
+	/** Converts a timestamp or duration in cycles to seconds. */
+	static FORCEINLINE double ToSeconds(uint64 Cycles) { return FPlatformTime::ToSeconds64(Cycles); }
+
+	/** Converts a duration in seconds to the nearest number of cycles, negative durations are clamped to 0. */
+	static FORCEINLINE uint64 ToCycles(double Seconds) { return Seconds > 0.0 ? static_cast<uint64>(Seconds / FPlatformTime::GetSecondsPerCycle64() + 0.5) : 0; }
+
+	/** Replaces the platform counter with another source of time, nullptr goes back to the platform counter. @returns the clock that was installed. */
+	static IGWBClock* SetClock(IGWBClock* InClock);
+
+	/** @returns the installed clock, nullptr if the platform counter is used. */
+	static IGWBClock* GetClock() { return Clock; }
+
+private:
+
+	static IGWBClock* Clock;
+};
+
+/**
+ * Clock that only moves when it's told to. Install it with `FGWBClock::SetClock` (or use `FScopedVirtualClock` in tests)
+ * and have work "take" time by advancing it, so budgets are used up exactly and instantly no matter the machine load.
+ */
+class FGWBVirtualClock : public IGWBClock
+{
+public:
+
+	explicit FGWBVirtualClock(uint64 InCycles = 0) : NowCycles(InCycles) {}
+
+	virtual uint64 GetCycles() const override { return NowCycles.load(std::memory_order_relaxed); }
+
+	void AdvanceCycles(uint64 Cycles) { NowCycles.fetch_add(Cycles, std::memory_order_relaxed); }
+	void AdvanceSeconds(double Seconds) { NowCycles.fetch_add(FGWBClock::ToCycles(Seconds), std::memory_order_relaxed); }
+	void SetCycles(uint64 Cycles) { NowCycles.store(Cycles, std::memory_order_relaxed); }
+
+private:
+
+	/** Atomic since work on other threads reads the clock, e.g. `GWBLoopUtils::BudgetedParallelFor`. */
+	std::atomic<uint64> NowCycles;
+};
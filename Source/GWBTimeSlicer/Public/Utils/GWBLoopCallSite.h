@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "DataTypes/GWBTimeSlicerHandle.h"
+#include "GWBTimeSlicersSubsystem.h"
+
+// C++20 std::source_location support
+#if __cplusplus >= 202002L && __has_include(<source_location>)
+    #include <source_location>
+    #define GWB_HAS_SOURCE_LOCATION 1
+#else
+    #define GWB_HAS_SOURCE_LOCATION 0
+#endif
+
+class UGWBTimeSlicer;
+
+/**
+ * A budgeted loop call site: the identifier of its time slicer, built once, and the handle it last resolved to in the
+ * registry of the world it was last called in, so calling the loop every frame doesn't format, hash or look up any names
+ * or subsystems. One lives in a function-local static per call site, see `GWBLoopUtils::GetLoopCallSite` and
+ * `BUDGETED_FOR_LOOP`. Only use it on the game thread, like the slicers.
+ */
+struct GWBTIMESLICER_API FGWBLoopCallSite
+{
+    explicit FGWBLoopCallSite(uint32 Hash);
+
+    /**
+     * Get or create the call site's time slicer in the registry of the context. Contexts in the world of the previous
+     * call resolve the cached handle in the cached registry of that world without any lookup, the slicer is only looked
+     * up again when the handle stopped resolving (the slicer was evicted) or the context is in another world (or none).
+     */
+    FORCEINLINE UGWBTimeSlicer* Resolve(const UObject* WorldContext)
+    {
+        const UWorld* World = WorldContext->GetWorld();
+        if (World && CachedWorld.Get() == World)
+        {
+            // a handle resolving in the registry it was handed out by is the call site's slicer, no need to compare names
+            const UGWBWorldTimeSlicersSubsystem* Subsystem = CachedSubsystem.Get();
+            if (UGWBTimeSlicer* TimeSlicer = Subsystem ? Subsystem->GetTimeSlicer(Handle) : nullptr)
+            {
+                return TimeSlicer;
+            }
+        }
+        return ResolveInContext(WorldContext);
+    }
+
+    FORCEINLINE FName GetId() const { return Id; }
+
+    /**
+     * Find the call site for a hash computed at runtime, for callers that can't have a static per call site (e.g. calls to
+     * `GWBLoopUtils::BudgetedForLoop` without the macro). Call sites are never removed, so the reference stays valid.
+     */
+    static FGWBLoopCallSite& FindOrAdd(uint32 Hash);
+
+private:
+    UGWBTimeSlicer* ResolveInContext(const UObject* WorldContext);
+
+    FName Id;
+    FGWBTimeSlicerHandle Handle;
+    TWeakObjectPtr<const UWorld> CachedWorld; // world the handle was last resolved for, its registry is `CachedSubsystem`'s
+    TWeakObjectPtr<const UGWBWorldTimeSlicersSubsystem> CachedSubsystem;
+};
+
+namespace GWBLoopUtils
+{
+    /** FNV-1a hash of a call site, constexpr so macros hash `__FILE__` and `__LINE__` at compile time. */
+    constexpr uint32 HashCallSite(const char* File, uint32 Line, const char* Function = "")
+    {
+        uint32 Hash = 2166136261u;
+        for (const char* Char = File; *Char; ++Char)
+        {
+            Hash = (Hash ^ static_cast<uint8>(*Char)) * 16777619u;
+        }
+        Hash = (Hash ^ Line) * 16777619u;
+        for (const char* Char = Function; *Char; ++Char)
+        {
+            Hash = (Hash ^ static_cast<uint8>(*Char)) * 16777619u;
+        }
+        return Hash;
+    }
+
+#if GWB_HAS_SOURCE_LOCATION
+    /** Hash of a source location, computed at compile time for `std::source_location::current()` in a constant expression. */
+    constexpr uint32 HashCallSite(const std::source_location& Location)
+    {
+        return HashCallSite(Location.file_name(), Location.line(), Location.function_name());
+    }
+#endif
+
+    /** @returns the call site for the hash, a function-local static per hash so every call after the first is free. */
+    template<uint32 CallSiteHash>
+    FORCEINLINE FGWBLoopCallSite& GetLoopCallSite()
+    {
+        static FGWBLoopCallSite CallSite(CallSiteHash);
+        return CallSite;
+    }
+
+#if GWB_HAS_SOURCE_LOCATION
+    /**
+     * @returns the call site of a source location passed at runtime (calls to `GWBLoopUtils::BudgetedForLoop` without the
+     * macro). The strings of a location are static, so every call from the same place passes the same file name: its
+     * strings are only hashed the first time, after that it's found by the file name's address, line and column in a small cache.
+     */
+    FORCEINLINE FGWBLoopCallSite& FindLoopCallSite(const std::source_location& Location)
+    {
+        struct FCachedLocation
+        {
+            const char* FileName = nullptr;
+            uint32 Line = 0;
+            uint32 Column = 0;
+            FGWBLoopCallSite* CallSite = nullptr;
+        };
+        static FCachedLocation CachedLocations[64];
+
+        const uint32 Slot = (PointerHash(Location.file_name()) ^ (Location.line() * 16777619u) ^ Location.column()) % UE_ARRAY_COUNT(CachedLocations);
+        FCachedLocation& CachedLocation = CachedLocations[Slot];
+        if (CachedLocation.FileName != Location.file_name() || CachedLocation.Line != Location.line() || CachedLocation.Column != Location.column())
+        {
+            CachedLocation = { Location.file_name(), Location.line(), Location.column(), &FGWBLoopCallSite::FindOrAdd(HashCallSite(Location)) };
+        }
+        return *CachedLocation.CallSite;
+    }
+#endif
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+/**
+ * Adapters that let the budgeted loops (see `GWBLoopUtils::BudgetedForLoop`) walk any range from the element a loop cursor
+ * points at. Every adapter has the same shape:
+ * - `GetIdentity()` picks the cursor of the container and `Num()` lets the cursor start over for a resized container
+ * - `Seek(Index)` positions the adapter on the element at the index and returns false past the last element, it's only
+ *   ever called with the same or a higher index than before
+ * - `Get()` returns (a reference to) the element it's positioned on
+ */
+namespace GWBLoopUtils::Private
+{
+    /** Indices only, for loops that index their container themselves (e.g. Blueprints, which only pass a count). */
+    struct FCountLoopRange
+    {
+        FCountLoopRange(const void* InIdentity, int32 InNum) : Identity(InIdentity), Count(InNum) {}
+
+        FORCEINLINE const void* GetIdentity() const { return Identity; }
+        FORCEINLINE int32 Num() const { return Count; }
+        FORCEINLINE bool Seek(int32 InIndex) { Index = InIndex; return Index < Count; }
+        FORCEINLINE int32 Get() const { return Index; }
+
+    private:
+        const void* Identity;
+        int32 Count;
+        int32 Index = 0;
+    };
+
+    /** Contiguous containers (TArray, TArrayView, ...), resuming is a plain index. Views of the same elements are the same loop. */
+    template<typename RangeType>
+    struct TContiguousLoopRange
+    {
+        explicit TContiguousLoopRange(RangeType& InRange) : Range(InRange), Count(static_cast<int32>(GetNum(InRange))) {}
+
+        FORCEINLINE const void* GetIdentity() const { return GetData(Range); }
+        FORCEINLINE int32 Num() const { return Count; }
+        FORCEINLINE bool Seek(int32 InIndex) { Index = InIndex; return Index < Count; }
+        FORCEINLINE decltype(auto) Get() const { return GetData(Range)[Index]; }
+
+    private:
+        RangeType& Range;
+        int32 Count;
+        int32 Index = 0;
+    };
+
+    /**
+     * Containers with iterators but without indexed access (TSet, TMap, ...). Resuming walks past the elements done by
+     * previous calls, so a call costs the index it resumes from on top of its own elements.
+     */
+    template<typename RangeType>
+    struct TForwardLoopRange
+    {
+        explicit TForwardLoopRange(RangeType& InRange) : Range(InRange), It(InRange.begin()), End(InRange.end()) {}
+
+        FORCEINLINE const void* GetIdentity() const { return &Range; }
+        FORCEINLINE int32 Num() const { return Range.Num(); }
+        FORCEINLINE bool Seek(int32 InIndex)
+        {
+            for (; Position < InIndex && It != End; ++It, ++Position) {}
+            return It != End;
+        }
+        FORCEINLINE decltype(auto) Get() { return *It; }
+
+    private:
+        RangeType& Range;
+        decltype(std::declval<RangeType&>().begin()) It;
+        decltype(std::declval<RangeType&>().end()) End;
+        int32 Position = 0;
+    };
+
+    /**
+     * Iterators that know when they're done (TObjectIterator, container iterators, ...). They're advanced in place and
+     * resume like forward ranges, by walking past the elements done by previous calls. Their number of elements isn't
+     * known up front, so the cursor only starts over after a completed pass or a break. They have no identity either, all
+     * iterator loops of a call site share one cursor.
+     */
+    template<typename IteratorType>
+    struct TIteratorLoopRange
+    {
+        explicit TIteratorLoopRange(IteratorType& InIterator) : It(InIterator) {}
+
+        FORCEINLINE const void* GetIdentity() const { return nullptr; }
+        FORCEINLINE int32 Num() const { return INDEX_NONE; }
+        FORCEINLINE bool Seek(int32 InIndex)
+        {
+            for (; Position < InIndex && It; ++It, ++Position) {}
+            return static_cast<bool>(It);
+        }
+        FORCEINLINE decltype(auto) Get() { return *It; }
+
+    private:
+        IteratorType& It;
+        int32 Position = 0;
+    };
+
+    /** @returns the adapter for the range: contiguous containers index, iterators advance in place and other ranges iterate. */
+    template<typename RangeType>
+    FORCEINLINE auto MakeLoopRange(RangeType& Range)
+    {
+        using DecayedRangeType = std::remove_cv_t<RangeType>;
+        if constexpr (TIsContiguousContainer<DecayedRangeType>::Value)
+        {
+            return TContiguousLoopRange<RangeType>(Range);
+        }
+        else if constexpr (std::is_constructible_v<bool, DecayedRangeType&>)
+        {
+            return TIteratorLoopRange<RangeType>(Range);
+        }
+        else
+        {
+            return TForwardLoopRange<RangeType>(Range);
+        }
+    }
+}
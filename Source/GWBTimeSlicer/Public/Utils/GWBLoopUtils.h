@@ -1,18 +1,15 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "DataTypes/GWBLoopCursor.h"
 #include "DataTypes/GWBTimeSlicedLoopScope.h"
 #include "DataTypes/GWBTimeSlicedScope.h"
-
-// C++20 std::source_location support
-#if __cplusplus >= 202002L && __has_include(<source_location>)
-    #include <source_location>
-    #define GWB_HAS_SOURCE_LOCATION 1
-#else
-    #define GWB_HAS_SOURCE_LOCATION 0
-#endif
+#include "Utils/GWBLoopCallSite.h"
+#include "Utils/GWBLoopRanges.h"
+#include <atomic>
 
 #include "GWBLoopUtils.generated.h"
 
@@ -39,6 +36,12 @@ public:
      */
     void Break();
 
+    /**
+     * Break out of the loop after the current iteration without registering a Blueprint break state, for loops that
+     * keep their own break state (e.g. `UGWBBudgetedForLoopAction`).
+     */
+    void BreakWithoutBlueprintState() { bShouldBreak = true; }
+
     /**
      * Check if the loop should break (used internally by the loop implementation).
      * @return true if Break() has been called, false otherwise
@@ -55,41 +58,282 @@ public:
      */
     uint32 GetHandleID() const { return HandleID; }
 
+    /**
+     * Get the index of the element the loop is currently on. Loops resume where they stopped the previous frame,
+     * so this is the element to process rather than the number of iterations done this frame.
+     */
+    int32 GetIndex() const { return Index; }
+
+    /**
+     * Set the index of the current element (used internally by the loop implementation).
+     */
+    void SetIndex(int32 InIndex) { Index = InIndex; }
+
 private:
     /** Unique identifier for this handle instance */
     UPROPERTY()
     uint32 HandleID = 0;
 
+    /** Index of the element the loop is currently on */
+    int32 Index = INDEX_NONE;
+
     /** Flag indicating whether the loop should break early (C++ only) */
     bool bShouldBreak = false;
 };
 
+/**
+ * What a budgeted loop did this call. Loops resume from the element they stopped at the previous call (per call site),
+ * so it takes a number of calls to get through a large array once and the result tells where in that pass this call was.
+ */
+USTRUCT(BlueprintType)
+struct GWBTIMESLICER_API FGWBBudgetedLoopResult
+{
+    GENERATED_BODY()
+
+    /** Index of the first element processed by this call */
+    UPROPERTY(BlueprintReadOnly, Category = "GWB|Loop Utils")
+    int32 StartIndex = 0;
+
+    /** Number of elements processed by this call */
+    UPROPERTY(BlueprintReadOnly, Category = "GWB|Loop Utils")
+    int32 NumProcessed = 0;
+
+    /** The last element was processed by this call, the next call starts a new pass from the first element */
+    UPROPERTY(BlueprintReadOnly, Category = "GWB|Loop Utils")
+    bool bCompleted = false;
+
+    /** The previous call completed a pass, so this call started over from the first element */
+    UPROPERTY(BlueprintReadOnly, Category = "GWB|Loop Utils")
+    bool bWrappedAround = false;
+
+    /** The loop was broken through its handle, the next call starts a new pass from the first element */
+    UPROPERTY(BlueprintReadOnly, Category = "GWB|Loop Utils")
+    bool bBroken = false;
+
+    /** @return the index the next call of the loop starts from (0 once a pass completed), for loops that leave resuming to their caller */
+    int32 GetNextIndex() const { return bCompleted || bBroken ? 0 : StartIndex + NumProcessed; }
+};
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FGWBBudgetedLoopWorkDelegate, FBudgetedLoopHandle&, LoopHandle);
 
 namespace GWBLoopUtils
 {
+    /**
+     * Runs a budgeted loop over a range (see `GWBLoopUtils::Private::MakeLoopRange`) with the time slicer of the scope,
+     * resuming from the element the loop stopped at the previous time it ran over the same range with that slicer. The
+     * slicer (one per call site) keeps a cursor per range identity, so a call site looping over a container per actor
+     * resumes each of them, and a cursor starts over when its container was resized. Shared by the C++ and Blueprint
+     * budgeted loops.
+     *
+     * @param TimeSlicer - Scope of the call site's time slicer, already configured with the loop's budgets
+     * @param Range - Adapter of the range to loop over
+     * @param DoWork - Called for every element with `(Element, Index, Handle)`, or only with the handle which knows the index
+     * @return what the loop did this call
+     */
+    template<typename LoopRangeType, typename WorkType>
+    FGWBBudgetedLoopResult RunBudgetedLoop(const FGWBTimeSlicedScope& TimeSlicer, LoopRangeType&& Range, WorkType&& DoWork)
+    {
+        FGWBLoopCursor& Cursor = TimeSlicer.GetTimeSlicer()->GetLoopCursor(Range.GetIdentity());
+        FGWBBudgetedLoopResult Result;
+        Result.bWrappedAround = Cursor.Begin(Range.Num());
+        Result.StartIndex = Cursor.Index;
+
+        // Create loop handle for break functionality
+        FBudgetedLoopHandle LoopHandle;
+        LoopHandle.Reset(); // Ensure clean state
+
+        bool bHasElement = Range.Seek(Cursor.Index);
+        while (bHasElement)
+        {
+            FGWBTimeSlicedLoopScope TimeSlicedWork = TimeSlicer.StartLoopScope();
+            if (TimeSlicedWork.IsOverBudget())
+            {
+                break;
+            }
+
+            // Execute the work function with the element (unless it only wants the handle)
+            LoopHandle.SetIndex(Cursor.Index);
+            if constexpr (std::is_invocable_v<WorkType&, FBudgetedLoopHandle&>)
+            {
+                DoWork(LoopHandle);
+            }
+            else
+            {
+                DoWork(Range.Get(), Cursor.Index, LoopHandle);
+            }
+            Cursor.Index++;
+            Result.NumProcessed++;
+
+            // A break ends the pass, the element it was called on counts as processed
+            if (LoopHandle.ShouldBreak())
+            {
+                Result.bBroken = true;
+                break;
+            }
+            bHasElement = Range.Seek(Cursor.Index);
+        }
+
+        if (Result.bBroken)
+        {
+            Cursor.Restart();
+        }
+        else if (!bHasElement)
+        {
+            Result.bCompleted = true;
+            Cursor.Complete();
+        }
+
+        // Clean up the Blueprint break state of the handle
+        LoopHandle.Reset();
+        return Result;
+    }
+
+    /**
+     * Runs a budgeted loop over `Num` indices, for callers that index their container themselves (see `RunBudgetedLoop`).
+     *
+     * @param LoopIdentity - Identifies the looped over container (its address)
+     * @param Num - Number of elements in the container
+     */
+    template<typename WorkType>
+    FGWBBudgetedLoopResult RunBudgetedLoop(const FGWBTimeSlicedScope& TimeSlicer, const void* LoopIdentity, int32 Num, WorkType&& DoWork)
+    {
+        return RunBudgetedLoop(TimeSlicer, Private::FCountLoopRange(LoopIdentity, Num), DoWork);
+    }
+
+    /**
+     * BUDGETED FOR LOOP function for any range at a call site resolved once (see `FGWBLoopCallSite`), what
+     * `BUDGETED_FOR_LOOP` expands to. Same as the versions below without any per call lookup of the call site's slicer.
+     * 
+     * @param CallSite - The call site's slicer, e.g. `GWBLoopUtils::GetLoopCallSite<GWBLoopUtils::HashCallSite(__FILE__, __LINE__)>()`
+     */
+    template<typename RangeType, typename WorkType>
+    static FGWBBudgetedLoopResult BudgetedForLoop(const UObject* WorldContext, float FrameBudget, uint32 MaxWorkCount, 
+                               RangeType&& Range, WorkType&& DoWork, FGWBLoopCallSite& CallSite)
+    {
+        // Handle edge cases
+        UGWBTimeSlicer* TimeSlicerObject = WorldContext && FrameBudget > 0.0f ? CallSite.Resolve(WorldContext) : nullptr;
+        if (!TimeSlicerObject)
+        {
+            return FGWBBudgetedLoopResult();
+        }
+
+        // Create the time-sliced reset scope
+        FGWBTimeSlicedScope TimeSlicer(TimeSlicerObject, FrameBudget, MaxWorkCount);
+
+        // Iterate through the range from where the previous call stopped
+        return RunBudgetedLoop(TimeSlicer, Private::MakeLoopRange(Range), DoWork);
+    }
+
+    /**
+     * BUDGETED PARALLEL FOR over a contiguous range (TArray, TArrayView, ...) that shares one time budget across threads.
+     * 
+     * The elements from StartIndex on are split into chunks that are handed out in order to the task graph workers (and
+     * the calling thread). Once the frame budget has run out no more chunks are handed out, the ones already handed out
+     * are finished, so the processed elements are always the ones from StartIndex up to the next index of the result. At
+     * least the first chunk is always processed, so the loop gets through the range even when the budget is tiny.
+     * The count budget caps the number of elements up front. A 4ms budget thereby becomes 4ms of wall time on all cores.
+     * There's no call site slicer or cursor, pass the next index of the result back in as StartIndex next frame.
+     * 
+     * The work runs on worker threads in any order, it must be safe to do for different elements at the same time.
+     * 
+     * @param FrameBudget - Time budget in seconds for this frame (e.g., 0.004 for 4ms), measured in wall time
+     * @param MaxWorkCount - Maximum number of elements to process this frame, 0 for no limit
+     * @param Range - The contiguous range to iterate through
+     * @param StartIndex - Index to start from, i.e. the next index of the previous frame's result (0 if out of range)
+     * @param DoWork - Function/lambda that receives each element by reference with its index, `(Element, Index)`
+     * @param ChunkSize - Number of elements handed out to a thread at once, larger chunks cost less to hand out but
+     *                    overshoot the time budget by more
+     * @return what the loop did this call, `GetNextIndex()` is the index to start from next frame
+     * 
+     * EXAMPLE:
+     * ```cpp
+     * LoopResult = GWBLoopUtils::BudgetedParallelFor(0.004, 0, Transforms, LoopResult.GetNextIndex(), [](FTransform& Transform, int32 Index) {
+     *     Transform.NormalizeRotation();
+     * });
+     * ```
+     */
+    template<typename RangeType, typename WorkType>
+    FGWBBudgetedLoopResult BudgetedParallelFor(double FrameBudget, uint32 MaxWorkCount, RangeType&& Range, int32 StartIndex,
+                                               WorkType&& DoWork, int32 ChunkSize = 64)
+    {
+        static_assert(TIsContiguousContainer<std::remove_cv_t<std::remove_reference_t<RangeType>>>::Value,
+                      "BudgetedParallelFor needs a contiguous range (TArray, TArrayView, ...)");
+
+        const int32 Num = static_cast<int32>(GetNum(Range));
+        FGWBBudgetedLoopResult Result;
+        Result.StartIndex = StartIndex >= 0 && StartIndex < Num ? StartIndex : 0;
+
+        // Handle edge cases
+        if (FrameBudget <= 0.0 || Num == 0)
+        {
+            return Result;
+        }
+
+        const int32 NumToDo = MaxWorkCount > 0 ? FMath::Min(Num - Result.StartIndex, static_cast<int32>(FMath::Min<uint32>(MaxWorkCount, MAX_int32))) : Num - Result.StartIndex;
+        ChunkSize = FMath::Max(ChunkSize, 1);
+        const int32 NumChunks = FMath::DivideAndRoundUp(NumToDo, ChunkSize);
+        const int32 NumThreads = FMath::Min(NumChunks, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+        const uint64 DeadlineCycles = FGWBClock::Cycles() + FGWBClock::ToCycles(FrameBudget);
+        auto* Elements = GetData(Range);
+
+        // Chunks are claimed in order, every claimed chunk is finished, so the done elements stay a single run from StartIndex.
+        // The deadline only stops claims once a chunk was claimed, so a budget used up by launching the threads still does
+        // the first chunk, like the serial loop always does its first element, instead of never getting anywhere
+        std::atomic<int32> NumChunksClaimed{0};
+        ParallelFor(NumThreads, [&](int32)
+        {
+            while (NumChunksClaimed.load(std::memory_order_relaxed) == 0 || FGWBClock::Cycles() < DeadlineCycles)
+            {
+                const int32 Chunk = NumChunksClaimed.fetch_add(1, std::memory_order_relaxed);
+                if (Chunk >= NumChunks)
+                {
+                    break;
+                }
+                const int32 ChunkStart = Result.StartIndex + Chunk * ChunkSize;
+                const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, Result.StartIndex + NumToDo);
+                for (int32 Index = ChunkStart; Index < ChunkEnd; ++Index)
+                {
+                    DoWork(Elements[Index], Index);
+                }
+            }
+        });
+
+        Result.NumProcessed = FMath::Min(FMath::Min(NumChunksClaimed.load(), NumChunks) * ChunkSize, NumToDo);
+        Result.bCompleted = Result.StartIndex + Result.NumProcessed >= Num;
+        return Result;
+    }
+
 #if GWB_HAS_SOURCE_LOCATION
     /**
-     * BUDGETED FOR LOOP function for TArray containers (C++20 version with std::source_location)
-     * Automatically generates unique call site identifiers using std::source_location.
+     * BUDGETED FOR LOOP function for any range (C++20 version with std::source_location)
+     * Automatically generates unique call site identifiers using std::source_location. The location is only hashed the
+     * first time, later calls find its call site in a small cache (see `FindLoopCallSite`), `BUDGETED_FOR_LOOP` hashes it
+     * at compile time instead.
      * 
      * Distributes expensive loop processing across multiple frames using FGWBTimeSlicedLoopScope
      * to maintain frame rate targets by respecting time and work unit count budgets.
-     * Users can call Break() on the provided handle to exit the loop early.
+     * Each call resumes from the element the previous call at the same call site stopped at and wraps around to the
+     * first element once the last one was processed (see `RunBudgetedLoop`).
+     * Users can call Break() on the provided handle to exit the loop early, the next call then starts over.
      * 
      * @param WorldContext - UObject providing world context (usually 'this' from calling object)
      * @param FrameBudget - Time budget in seconds for this frame (e.g., 0.1f for 100ms)
      * @param MaxWorkCount - Maximum number of work units allowed per frame
-     * @param Array - The TArray to iterate through
-     * @param DoWork - Function/lambda that receives a break handle pointer for each iteration
+     * @param Range - The range to iterate through: a TArray, TArrayView, TSet, TMap or an iterator such as TObjectIterator
+     * @param DoWork - Function/lambda that receives each element by reference with its index and the break handle,
+     *                 `(Element, Index, Handle)`, or only the break handle
      * @param Location - Source location (automatically captured at call site)
+     * @return what the loop did this call, e.g. whether it completed a pass over the range
+     * 
+     * Arrays resume at their index right away, other ranges walk past the elements done by previous calls. Iterators are
+     * advanced in place, so pass a new one every call.
      * 
      * EXAMPLE:
      * ```cpp
      * // Automatic call site identification with C++20 and break capability
-     * GWBLoopUtils::BudgetedForLoop(this, 0.1f, 10, MyArray, [&](FBudgetedLoopHandle& Handle) {
+     * GWBLoopUtils::BudgetedForLoop(this, 0.1f, 10, MyArray, [&](FMyElement& Element, int32 Index, FBudgetedLoopHandle& Handle) {
      *     // Process current array element
-     *     DoSomeExpensiveProcessing();
+     *     DoSomeExpensiveProcessing(Element);
      *     
      *     if (SomeCondition)
      *     {
@@ -99,70 +343,44 @@ namespace GWBLoopUtils
      * });
      * ```
      */
-    template<typename T>
-    static void BudgetedForLoop(const UObject* WorldContext, float FrameBudget, uint32 MaxWorkCount, 
-                               const TArray<T>& Array, TFunction<void(FBudgetedLoopHandle&)> DoWork, 
+    template<typename RangeType, typename WorkType>
+    static FGWBBudgetedLoopResult BudgetedForLoop(const UObject* WorldContext, float FrameBudget, uint32 MaxWorkCount, 
+                               RangeType&& Range, WorkType&& DoWork, 
                                const std::source_location& Location = std::source_location::current())
     {
-        // Handle edge cases
-        if (!WorldContext || Array.Num() == 0 || FrameBudget <= 0.0f)
-        {
-            return;
-        }
-        
-        // Generate unique ID from source location (hash file name, line, and function)
-        FString LocationString = FString::Printf(TEXT("%s:%u:%s"), 
-            ANSI_TO_TCHAR(Location.file_name()), 
-            Location.line(), 
-            ANSI_TO_TCHAR(Location.function_name()));
-        
-        // Hash to prevent file path leakage and create clean FName
-        uint32 LocationHash = GetTypeHash(LocationString);
-        FName UniqueId = *FString::Printf(TEXT("BudgetedLoop_%u"), LocationHash);
-        
-        // Create the time-sliced reset scope
-        FGWBTimeSlicedScope TimeSlicer(WorldContext, UniqueId, FrameBudget, MaxWorkCount);
-
-        // Create loop handle for break functionality
-        FBudgetedLoopHandle LoopHandle;
-        LoopHandle.Reset(); // Ensure clean state
-        
-        // Iterate through the array
-        for (int32 Index = 0; Index < Array.Num(); ++Index)
-        {
-            FGWBTimeSlicedLoopScope TimeSlicedWork = TimeSlicer.StartLoopScope();
-            // Check if we're over budget OR user requested break
-            if (TimeSlicedWork.IsOverBudget() || LoopHandle.ShouldBreak())
-            {
-                break;
-            }
-            
-            // Execute the work function with handle
-            DoWork(LoopHandle);
-        }
+        // The source location is only hashed (file name, line and function) the first time, the hash also keeps file paths out of the slicer's name
+        FGWBLoopCallSite& CallSite = FindLoopCallSite(Location);
+        return BudgetedForLoop(WorldContext, FrameBudget, MaxWorkCount, Forward<RangeType>(Range), Forward<WorkType>(DoWork), CallSite);
     }
 #else
     /**
-     * BUDGETED FOR LOOP function for TArray containers (fallback version for pre-C++20)
+     * BUDGETED FOR LOOP function for any range (fallback version for pre-C++20)
      * Uses manual CallSiteId parameter for unique identification.
      * 
      * Distributes expensive loop processing across multiple frames using FGWBTimeSlicedLoopScope
      * to maintain frame rate targets by respecting time and work unit count budgets.
-     * Users can call Break() on the provided handle to exit the loop early.
+     * Each call resumes from the element the previous call with the same CallSiteId stopped at and wraps around to the
+     * first element once the last one was processed (see `RunBudgetedLoop`).
+     * Users can call Break() on the provided handle to exit the loop early, the next call then starts over.
      * 
      * @param WorldContext - UObject providing world context (usually 'this' from calling object)
      * @param FrameBudget - Time budget in seconds for this frame (e.g., 0.1f for 100ms)
      * @param MaxWorkCount - Maximum number of work units allowed per frame
-     * @param Array - The TArray to iterate through
-     * @param DoWork - Function/lambda that receives a break handle pointer for each iteration
+     * @param Range - The range to iterate through: a TArray, TArrayView, TSet, TMap or an iterator such as TObjectIterator
+     * @param DoWork - Function/lambda that receives each element by reference with its index and the break handle,
+     *                 `(Element, Index, Handle)`, or only the break handle
      * @param CallSiteId - Unique identifier for this call site (use macro for auto-generation)
+     * @return what the loop did this call, e.g. whether it completed a pass over the range
+     * 
+     * Arrays resume at their index right away, other ranges walk past the elements done by previous calls. Iterators are
+     * advanced in place, so pass a new one every call.
      * 
      * EXAMPLE:
      * ```cpp
      * // Use the macro for automatic unique ID generation and break capability
-     * BUDGETED_FOR_LOOP(this, 0.1f, 10, MyArray, [&](FBudgetedLoopHandle& Handle) {
+     * BUDGETED_FOR_LOOP(this, 0.1f, 10, MyArray, [&](FMyElement& Element, int32 Index, FBudgetedLoopHandle& Handle) {
      *     // Process current array element
-     *     DoSomeExpensiveProcessing();
+     *     DoSomeExpensiveProcessing(Element);
      *     
      *     if (SomeCondition)
      *     {
@@ -177,14 +395,14 @@ namespace GWBLoopUtils
      * }, TEXT("MyCustomLoop"));
      * ```
      */
-    template<typename T>
-    static void BudgetedForLoop(const UObject* WorldContext, float FrameBudget, uint32 MaxWorkCount, 
-                               const TArray<T>& Array, TFunction<void(FBudgetedLoopHandle&)> DoWork, const FName& CallSiteId = NAME_None)
+    template<typename RangeType, typename WorkType>
+    static FGWBBudgetedLoopResult BudgetedForLoop(const UObject* WorldContext, float FrameBudget, uint32 MaxWorkCount, 
+                               RangeType&& Range, WorkType&& DoWork, const FName& CallSiteId = NAME_None)
     {
         // Handle edge cases
-        if (!WorldContext || Array.Num() == 0 || FrameBudget <= 0.0f)
+        if (!WorldContext || FrameBudget <= 0.0f)
         {
-            return;
+            return FGWBBudgetedLoopResult();
         }
         
         // Generate a unique ID if none provided
@@ -194,25 +412,11 @@ namespace GWBLoopUtils
             UniqueId = FName(TEXT("BudgetedForLoop_Default"));
         }
         
-        // Create the time-sliced loop scope
-        FGWBTimeSlicedLoopScope TimeSlicedWork(WorldContext, UniqueId, FrameBudget, MaxWorkCount);
-        
-        // Create loop handle for break functionality
-        FBudgetedLoopHandle LoopHandle;
-        LoopHandle.Reset(); // Ensure clean state
-        
-        // Iterate through the array
-        for (int32 Index = 0; Index < Array.Num(); ++Index)
-        {
-            // Check if we're over budget OR user requested break
-            if (TimeSlicedWork.IsOverBudget() || LoopHandle.ShouldBreak())
-            {
-                break;
-            }
-            
-            // Execute the work function with handle
-            DoWork(LoopHandle);
-        }
+        // Create the time-sliced reset scope
+        FGWBTimeSlicedScope TimeSlicer(WorldContext, UniqueId, FrameBudget, MaxWorkCount);
+
+        // Iterate through the range from where the previous call stopped
+        return RunBudgetedLoop(TimeSlicer, Private::MakeLoopRange(Range), DoWork);
     }
 #endif
 }
@@ -240,19 +444,25 @@ public:
      * @param ArrayCount - Number of elements to process (mimics array length)
      * @param WorkDelegate - Blueprint event/function to call for each work unit (receives loop handle)
      * @param CallSiteId - Optional unique identifier for this loop (leave empty for auto-generation)
+     * @return what the loop did this call, e.g. whether it completed a pass over the elements
      * 
      * USAGE IN BLUEPRINTS:
      * 1. Call this function on Tick or when you want to process work
-     * 2. Connect your expensive processing logic to the WorkDelegate
+     * 2. Connect your expensive processing logic to the WorkDelegate, use "Get Budgeted Loop Index" on the LoopHandle
+     *    to know which element to process
      * 3. Use the LoopHandle parameter with "Break Budgeted Loop" node to exit early
      * 4. The function will automatically break when budget is exceeded or Break() is called
-     * 5. Call again next frame to continue processing
+     * 5. Call again next frame to continue processing from where it stopped, the Completed output of the result tells
+     *    when the last element was processed (the call after that starts over from the first one)
+     *
+     * The loop starts over when ArrayCount or WorldContextObject change, or after a break.
+     * To have the loop carry on across frames on its own, use "Budgeted For Loop (Latent)" (see `UGWBBudgetedForLoopAction`).
      */
     UFUNCTION(BlueprintCallable, Category = "GWB|Loop Utils", 
               meta = (DisplayName = "Budgeted For Loop", 
                       ToolTip = "Distributes expensive loop processing across frames to maintain performance. Use 'Break Budgeted Loop' node with LoopHandle to exit early.",
                       CallInEditor = "false"))
-    static void BudgetedForLoopBlueprint(
+    static FGWBBudgetedLoopResult BudgetedForLoopBlueprint(
         const UObject* WorldContextObject,
         float FrameBudget,
         int32 MaxWorkCount,
@@ -282,6 +492,16 @@ public:
               meta = (DisplayName = "Is Budgeted Loop Broken"))
     static bool IsBudgetedLoopBroken(const FBudgetedLoopHandle& LoopHandle);
 
+    /**
+     * Get the index of the element a budgeted loop is currently on.
+     * 
+     * @param LoopHandle - The handle passed to your work delegate
+     * @return the index of the element to process
+     */
+    UFUNCTION(BlueprintPure, Category = "GWB|Loop Utils",
+              meta = (DisplayName = "Get Budgeted Loop Index"))
+    static int32 GetBudgetedLoopIndex(const FBudgetedLoopHandle& LoopHandle);
+
 protected:
     /** Static map to track break states by handle ID for Blueprint usage */
     static TMap<uint32, bool> BlueprintBreakStates;
@@ -290,13 +510,14 @@ protected:
 #if GWB_HAS_SOURCE_LOCATION
 /**
  * Macro wrapper for BudgetedForLoop with C++20 std::source_location support.
- * Automatically captures call site information for perfect unique identification.
+ * Automatically captures call site information for perfect unique identification. The location is hashed at compile
+ * time and its slicer is cached in a static per call site, so calling the loop costs no lookups (see `FGWBLoopCallSite`).
  * 
  * @param WorldContext - UObject providing world context (usually 'this' from calling object)
  * @param FrameBudget - Time budget in seconds for this frame (e.g., 0.1f for 100ms)
  * @param MaxWorkCount - Maximum number of work units allowed per frame
- * @param Array - The TArray to iterate through
- * @param DoWork - Function/lambda that receives a break handle for each iteration
+ * @param Range - The range to iterate through (TArray, TArrayView, TSet, TMap or an iterator such as TObjectIterator)
+ * @param DoWork - Function/lambda that receives `(Element, Index, Handle)` or only the break handle for each iteration
  * 
  * USAGE:
  * ```cpp
@@ -310,20 +531,21 @@ protected:
  * });
  * ```
  */
-#define BUDGETED_FOR_LOOP(WorldContext, FrameBudget, MaxWorkCount, Array, DoWork) \
-    GWBLoopUtils::BudgetedForLoop(WorldContext, FrameBudget, MaxWorkCount, Array, DoWork)
+#define BUDGETED_FOR_LOOP(WorldContext, FrameBudget, MaxWorkCount, Range, DoWork) \
+    GWBLoopUtils::BudgetedForLoop(WorldContext, FrameBudget, MaxWorkCount, Range, DoWork, \
+        GWBLoopUtils::GetLoopCallSite<GWBLoopUtils::HashCallSite(std::source_location::current())>())
 
 #else
 /**
  * Macro wrapper for BudgetedForLoop (fallback for pre-C++20) that generates unique call site identifiers
- * using a hash of __FILE__ and __LINE__ to ensure each call site gets its own time slicer instance
- * while preventing file path leakage at runtime.
+ * using a compile time hash of __FILE__ and __LINE__ to ensure each call site gets its own time slicer instance
+ * while preventing file path leakage at runtime. The slicer is cached in a static per call site (see `FGWBLoopCallSite`).
  * 
  * @param WorldContext - UObject providing world context (usually 'this' from calling object)
  * @param FrameBudget - Time budget in seconds for this frame (e.g., 0.1f for 100ms)
  * @param MaxWorkCount - Maximum number of work units allowed per frame
- * @param Array - The TArray to iterate through
- * @param DoWork - Function/lambda that receives a break handle for each iteration
+ * @param Range - The range to iterate through (TArray, TArrayView, TSet, TMap or an iterator such as TObjectIterator)
+ * @param DoWork - Function/lambda that receives `(Element, Index, Handle)` or only the break handle for each iteration
  * 
  * USAGE:
  * ```cpp
@@ -337,8 +559,8 @@ protected:
  * });
  * ```
  */
-#define BUDGETED_FOR_LOOP(WorldContext, FrameBudget, MaxWorkCount, Array, DoWork) \
-    GWBLoopUtils::BudgetedForLoop(WorldContext, FrameBudget, MaxWorkCount, Array, DoWork, \
-        *FString::Printf(TEXT("BudgetedLoop_%u"), GetTypeHash(FString::Printf(TEXT("%s:%d"), ANSI_TO_TCHAR(__FILE__), __LINE__))))
+#define BUDGETED_FOR_LOOP(WorldContext, FrameBudget, MaxWorkCount, Range, DoWork) \
+    GWBLoopUtils::BudgetedForLoop(WorldContext, FrameBudget, MaxWorkCount, Range, DoWork, \
+        GWBLoopUtils::GetLoopCallSite<GWBLoopUtils::HashCallSite(__FILE__, __LINE__)>())
 
 #endif
\ No newline at end of file